@@ -0,0 +1,127 @@
+#include "Allocator.h"
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+static void* mallocAlloc(void* context, int size){
+  (void)context;
+  return malloc(size);
+}
+
+static void* mallocRealloc(void* context, void* oldPtr, int oldSize, int newSize){
+  (void)context;
+  (void)oldSize;
+  return realloc(oldPtr, newSize);
+}
+
+static void mallocFree(void* context, void* ptr, int size){
+  (void)context;
+  (void)size;
+  free(ptr);
+}
+
+static const Allocator defaultAllocator = {mallocAlloc, mallocRealloc, mallocFree, NULL};
+static Allocator currentAllocator       = {mallocAlloc, mallocRealloc, mallocFree, NULL};
+static MemoryStats memoryStats[NUM_OF_MEM_TYPE];
+static int allocatorVersion             = MALLOC_VERSION;
+static int numOfAllocatorVersion        = MALLOC_VERSION;
+
+/*
+ *  An ErrorObject can outlive the Allocator that was installed when it
+ *  was thrown (a Catch after endCompileSession), so it always come from
+ *  malloc
+ */
+static const Allocator* allocatorOf(MemoryType memType){
+  return memType == MEM_ERROR ? &defaultAllocator : &currentAllocator;
+}
+
+/**
+ * setAllocator
+ *  Install (allocator) as the Allocator of the library, the Allocator is
+ *  copied so the caller does not have to keep it. NULL bring back malloc.
+ *
+ *  Memory must be given back to the Allocator that handed it out, so the
+ *  Allocator should only be changed when nothing allocated is still alive
+ *  or when it is changed back before those are freed.
+ */
+void setAllocator(Allocator* allocator){
+  if(allocator == NULL)
+    currentAllocator = defaultAllocator;
+  else
+    currentAllocator = *allocator;
+
+  if(currentAllocator.alloc == defaultAllocator.alloc && currentAllocator.free == defaultAllocator.free)
+    allocatorVersion = MALLOC_VERSION;
+  else
+    allocatorVersion = ++numOfAllocatorVersion;
+}
+
+/**
+ * getAllocatorVersion
+ *  A number telling the installed Allocator apart from the one before,
+ *  it change with every setAllocator of another Allocator and is always
+ *  MALLOC_VERSION while malloc is installed. Something kept across calls
+ *  can check it to know whether the memory it hold came from the
+ *  Allocator installed now.
+ */
+int getAllocatorVersion(){
+  return allocatorVersion;
+}
+
+Allocator getAllocator(){
+  return currentAllocator;
+}
+
+void* memAlloc(MemoryType memType, int size){
+  assert(memType >= 0 && memType < NUM_OF_MEM_TYPE);
+  const Allocator* allocator = allocatorOf(memType);
+  void* newPtr = allocator->alloc(allocator->context, size);
+  assert(newPtr != NULL);
+
+  memoryStats[memType].numOfAlloc++;
+  memoryStats[memType].bytesAlloc += size;
+
+  return newPtr;
+}
+
+/**
+ * memRealloc
+ *  Growing an array count as one allocation of the extra bytes,
+ *  shrinking count as freeing the bytes given back.
+ */
+void* memRealloc(MemoryType memType, void* oldPtr, int oldSize, int newSize){
+  assert(memType >= 0 && memType < NUM_OF_MEM_TYPE);
+  const Allocator* allocator = allocatorOf(memType);
+  void* newPtr = allocator->realloc(allocator->context, oldPtr, oldSize, newSize);
+  assert(newPtr != NULL);
+
+  if(newSize >= oldSize){
+    memoryStats[memType].numOfAlloc++;
+    memoryStats[memType].bytesAlloc += newSize - oldSize;
+  }else{
+    memoryStats[memType].numOfFree++;
+    memoryStats[memType].bytesFreed += oldSize - newSize;
+  }
+
+  return newPtr;
+}
+
+void memFree(MemoryType memType, void* ptr, int size){
+  assert(memType >= 0 && memType < NUM_OF_MEM_TYPE);
+  if(ptr == NULL)
+    return;
+
+  allocatorOf(memType)->free(allocatorOf(memType)->context, ptr, size);
+
+  memoryStats[memType].numOfFree++;
+  memoryStats[memType].bytesFreed += size;
+}
+
+MemoryStats getMemoryStats(MemoryType memType){
+  assert(memType >= 0 && memType < NUM_OF_MEM_TYPE);
+  return memoryStats[memType];
+}
+
+void resetMemoryStats(){
+  memset(memoryStats, 0, sizeof(memoryStats));
+}
@@ -0,0 +1,70 @@
+#ifndef Allocator_H
+#define Allocator_H
+
+/**
+ * Allocator
+ *
+ *  Every allocation of the library go through the current Allocator.
+ *  By default it is malloc/realloc/free, a caller can install its own
+ *  (memory pool, jemalloc, ...) with setAllocator. ErrorObject is the
+ *  exception, it always come from malloc so a Catch handler can still
+ *  read and free it after the Allocator was changed.
+ *
+ *  Allocator contain:
+ *    1. alloc      return (size) bytes
+ *    2. realloc    resize (oldPtr) from (oldSize) to (newSize) bytes
+ *    3. free       give back (ptr) of (size) bytes
+ *    4. context    passed as the first argument of the three functions
+ *
+ *  Eg.
+ *    Allocator poolAllocator = {poolAlloc, poolRealloc, poolFree, myPool};
+ *    setAllocator(&poolAllocator);
+ *      ...
+ *    setAllocator(NULL);                 << back to malloc
+ *
+ *
+ * MemoryStats
+ *
+ *  Every allocation is counted under the subsystem that asked for it,
+ *  whatever Allocator is installed:
+ *    MEM_LIST        LinkedList, ListElement, Vector and other containers
+ *    MEM_NODE        Node and its children array
+ *    MEM_EXPRESSION  Expression
+ *    MEM_ERROR       ErrorObject and its message
+ */
+#define MALLOC_VERSION  0       // getAllocatorVersion while malloc is installed
+
+typedef enum{
+  MEM_LIST,
+  MEM_NODE,
+  MEM_EXPRESSION,
+  MEM_ERROR,
+  NUM_OF_MEM_TYPE
+}MemoryType;
+
+typedef struct{
+  void* (*alloc)(void* context, int size);
+  void* (*realloc)(void* context, void* oldPtr, int oldSize, int newSize);
+  void  (*free)(void* context, void* ptr, int size);
+  void* context;
+}Allocator;
+
+typedef struct{
+  long numOfAlloc;
+  long numOfFree;
+  long bytesAlloc;
+  long bytesFreed;
+}MemoryStats;
+
+void setAllocator(Allocator* allocator);
+Allocator getAllocator();
+int getAllocatorVersion();
+
+void* memAlloc(MemoryType memType, int size);
+void* memRealloc(MemoryType memType, void* oldPtr, int oldSize, int newSize);
+void memFree(MemoryType memType, void* ptr, int size);
+
+MemoryStats getMemoryStats(MemoryType memType);
+void resetMemoryStats();
+
+#endif // Allocator_H
@@ -0,0 +1,171 @@
+#include "Arena.h"
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#define ALIGN_UP(size)      (((size) + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1))
+#define BLOCK_HEADER_SIZE   ALIGN_UP((int)sizeof(ArenaBlock))
+
+static Arena* currentArena = NULL;
+
+/**
+ * createArena
+ *  Calling the function will generate an empty Arena and return it.
+ *  No block is reserved until the first arenaAlloc.
+ *
+ *  blockSize   size of a normal block, ARENA_BLOCK_SIZE is used when
+ *              blockSize is zero or negative
+ */
+Arena* createArena(int blockSize){
+  Arena* newArena = malloc(sizeof(Arena));
+  assert(newArena != NULL);
+
+  newArena->head        = NULL;
+  newArena->blockSize   = blockSize > 0 ? blockSize : ARENA_BLOCK_SIZE;
+  newArena->prevSession = NULL;
+  memset(&newArena->stats, 0, sizeof(ArenaStats));
+
+  return newArena;
+}
+
+static ArenaBlock* addArenaBlock(Arena* arena, int minSize){
+  int size = arena->blockSize;
+  if(size < minSize)
+    size = minSize;
+
+  ArenaBlock* newBlock = malloc(BLOCK_HEADER_SIZE + size);
+  assert(newBlock != NULL);
+
+  newBlock->size = size;
+  newBlock->used = 0;
+  newBlock->next = arena->head;
+  arena->head    = newBlock;
+
+  arena->stats.numOfBlock++;
+  arena->stats.bytesReserved += size;
+
+  return newBlock;
+}
+
+/**
+ * arenaAlloc
+ *  Hand out (size) bytes from the head block of the arena. A new block
+ *  is reserved when the head block does not have enough space left.
+ *  Request bigger than blockSize get a block of their own.
+ */
+void* arenaAlloc(Arena* arena, int size){
+  assert(arena != NULL);
+  ArenaBlock* block = arena->head;
+  void* newPtr;
+
+  size = ALIGN_UP(size);
+  if(block == NULL || block->size - block->used < size)
+    block = addArenaBlock(arena, size);
+
+  newPtr = (char*)block + BLOCK_HEADER_SIZE + block->used;
+  block->used += size;
+
+  arena->stats.numOfAlloc++;
+  arena->stats.bytesUsed += size;
+
+  return newPtr;
+}
+
+/**
+ * arenaRealloc
+ *  Arena memory cannot be resized in place unless it is the last thing
+ *  handed out from the head block. Otherwise new space is taken and the
+ *  old content is copied over, the old space is only released with the arena.
+ */
+void* arenaRealloc(Arena* arena, void* oldPtr, int oldSize, int newSize){
+  assert(arena != NULL);
+  ArenaBlock* block = arena->head;
+  void* newPtr;
+
+  if(oldPtr == NULL)
+    return arenaAlloc(arena, newSize);
+
+  oldSize = ALIGN_UP(oldSize);
+  newSize = ALIGN_UP(newSize);
+  if(block != NULL && (char*)oldPtr + oldSize == (char*)block + BLOCK_HEADER_SIZE + block->used \
+     && block->used - oldSize + newSize <= block->size){
+    block->used += newSize - oldSize;
+    arena->stats.bytesUsed += newSize - oldSize;
+    return oldPtr;
+  }
+
+  newPtr = arenaAlloc(arena, newSize);
+  memcpy(newPtr, oldPtr, oldSize < newSize ? oldSize : newSize);
+  return newPtr;
+}
+
+void freeArena(Arena* arena){
+  if(arena == NULL)
+    return;
+
+  ArenaBlock *block = arena->head, *nextBlock;
+  while(block != NULL){
+    nextBlock = block->next;
+    free(block);
+    block = nextBlock;
+  }
+  free(arena);
+}
+
+static void* sessionAlloc(void* context, int size){
+  return arenaAlloc((Arena*)context, size);
+}
+
+static void* sessionRealloc(void* context, void* oldPtr, int oldSize, int newSize){
+  return arenaRealloc((Arena*)context, oldPtr, oldSize, newSize);
+}
+
+//the Arena give everything back at once in freeArena
+static void sessionFree(void* context, void* ptr, int size){
+  (void)context;
+  (void)ptr;
+  (void)size;
+}
+
+/**
+ * beginCompileSession
+ *  Create a new Arena and install it as the Allocator. Session can be
+ *  nested, endCompileSession bring back the Allocator of the outer session.
+ */
+Arena* beginCompileSession(){
+  Arena* sessionArena = createArena(ARENA_BLOCK_SIZE);
+  Allocator sessionAllocator = {sessionAlloc, sessionRealloc, sessionFree, sessionArena};
+
+  sessionArena->prevSession   = currentArena;
+  sessionArena->prevAllocator = getAllocator();
+  currentArena = sessionArena;
+  setAllocator(&sessionAllocator);
+
+  return sessionArena;
+}
+
+/**
+ * endCompileSession
+ *  Release every LinkedList, ListElement, Node and Expression created
+ *  since the matching beginCompileSession and return the allocation
+ *  statistic of the session.
+ */
+ArenaStats endCompileSession(){
+  ArenaStats stats;
+  Arena* sessionArena = currentArena;
+
+  memset(&stats, 0, sizeof(ArenaStats));
+  if(sessionArena == NULL)
+    return stats;
+
+  stats        = sessionArena->stats;
+  currentArena = sessionArena->prevSession;
+  setAllocator(&sessionArena->prevAllocator);
+  freeArena(sessionArena);
+
+  return stats;
+}
+
+Arena* getSessionArena(){
+  return currentArena;
+}
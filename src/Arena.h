@@ -0,0 +1,74 @@
+#ifndef Arena_H
+#define Arena_H
+
+#include "Allocator.h"
+
+/**
+ * Arena
+ *
+ *  Object of Arena's type hand out memory from big blocks instead of
+ *  calling malloc for every small object. Nothing inside an Arena is
+ *  freed one by one, the whole Arena is released in one call.
+ *
+ *  Arena contain:
+ *    1. head       the block currently used to hand out memory
+ *    2. blockSize  the size of a normal block
+ *    3. stats      number of allocation and bytes used so far
+ *
+ *
+ * Compile Session
+ *
+ *  A compile session install an Allocator that hand out memory from a
+ *  new Arena, so createLinkedList, createListElement, createNode,
+ *  createExpression and every temporary list built by the library
+ *  allocate from that Arena. memFree does nothing inside a session.
+ *  endCompileSession bring back the Allocator used before the session.
+ *
+ *  Eg.
+ *    beginCompileSession();
+ *      ...build the tree, assignAllNodeSSA, allocPhiFunc...
+ *    ArenaStats stats = endCompileSession();   << everything released here
+ *
+ *  getNodeOrder keep the orders of a CFG inside its root, from whichever
+ *  Allocator is installed when it build them. A CFG made outside the
+ *  session can still be walked inside it and after it: orders kept with
+ *  another Allocator than the one installed now are dropped instead of
+ *  being given back to the wrong one, those of malloc go back to malloc.
+ *
+ */
+#define ARENA_BLOCK_SIZE  65536
+#define ARENA_ALIGN       8
+
+typedef struct ArenaBlock_t ArenaBlock;
+struct ArenaBlock_t{
+  ArenaBlock* next;
+  int size;
+  int used;
+};
+
+typedef struct{
+  int numOfAlloc;
+  int numOfBlock;
+  long bytesUsed;
+  long bytesReserved;
+}ArenaStats;
+
+typedef struct Arena_t Arena;
+struct Arena_t{
+  ArenaBlock* head;
+  int blockSize;
+  ArenaStats stats;
+  Arena* prevSession;
+  Allocator prevAllocator;
+};
+
+Arena* createArena(int blockSize);
+void* arenaAlloc(Arena* arena, int size);
+void* arenaRealloc(Arena* arena, void* oldPtr, int oldSize, int newSize);
+void freeArena(Arena* arena);
+
+Arena* beginCompileSession();
+ArenaStats endCompileSession();
+Arena* getSessionArena();
+
+#endif // Arena_H
@@ -0,0 +1,279 @@
+#include "BitSet.h"
+#include "Allocator.h"
+#include <string.h>
+#include <assert.h>
+
+#define WORD_OF(number)   ((number) / BITS_PER_WORD)
+#define MASK_OF(number)   ((uint64_t)1 << ((number) % BITS_PER_WORD))
+
+static int countBit(uint64_t word){
+  return __builtin_popcountll(word);
+}
+
+static int lowestBit(uint64_t word){
+  return __builtin_ctzll(word);
+}
+
+/**
+ * createBitSet
+ *  Calling the function will generate an empty BitSet and return it
+ *
+ *  numOfBit  the number of bit reserved at the beginning, the BitSet
+ *            grow when a bigger number is added
+ */
+BitSet* createBitSet(int numOfBit){
+  BitSet* newSet = memAlloc(MEM_LIST, sizeof(BitSet));
+  assert(newSet != NULL);
+
+  if(numOfBit < BITS_PER_WORD)
+    numOfBit = BITS_PER_WORD;
+
+  newSet->numOfWord = WORD_OF(numOfBit - 1) + 1;
+  newSet->word      = memAlloc(MEM_LIST, sizeof(uint64_t) * newSet->numOfWord);
+  memset(newSet->word, 0, sizeof(uint64_t) * newSet->numOfWord);
+
+  return newSet;
+}
+
+static void growBitSet(BitSet* set, int numOfWord){
+  int newNumOfWord = set->numOfWord * 2;
+  if(newNumOfWord < numOfWord)
+    newNumOfWord = numOfWord;
+
+  set->word = memRealloc(MEM_LIST, set->word, sizeof(uint64_t) * set->numOfWord, \
+                         sizeof(uint64_t) * newNumOfWord);
+  assert(set->word != NULL);
+  memset(&set->word[set->numOfWord], 0, sizeof(uint64_t) * (newNumOfWord - set->numOfWord));
+  set->numOfWord = newNumOfWord;
+}
+
+void bitSetAdd(BitSet* set, int number){
+  if(set == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: BitSet cannot be NULL!");
+
+  if(number < 0)
+    ThrowError(ERR_INDEX_OUT_OF_RANGE, "Number %d cannot be put into a BitSet", number);
+
+  if(WORD_OF(number) >= set->numOfWord)
+    growBitSet(set, WORD_OF(number) + 1);
+
+  set->word[WORD_OF(number)] |= MASK_OF(number);
+}
+
+void bitSetRemove(BitSet* set, int number){
+  if(set == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: BitSet cannot be NULL!");
+
+  if(number >= 0 && WORD_OF(number) < set->numOfWord)
+    set->word[WORD_OF(number)] &= ~MASK_OF(number);
+}
+
+int bitSetHas(BitSet* set, int number){
+  if(set == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: BitSet cannot be NULL!");
+
+  if(number < 0 || WORD_OF(number) >= set->numOfWord)
+    return 0;
+
+  return (set->word[WORD_OF(number)] & MASK_OF(number)) != 0;
+}
+
+void bitSetClear(BitSet* set){
+  if(set == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: BitSet cannot be NULL!");
+
+  memset(set->word, 0, sizeof(uint64_t) * set->numOfWord);
+}
+
+int bitSetCount(BitSet* set){
+  int i, count = 0;
+
+  if(set == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: BitSet cannot be NULL!");
+
+  for(i = 0; i < set->numOfWord; i++)
+    count += countBit(set->word[i]);
+
+  return count;
+}
+
+/**
+ * bitSetNext
+ *  return the smallest member that is equal or bigger than (from),
+ *  -1 is returned when there is none
+ */
+int bitSetNext(BitSet* set, int from){
+  int i;
+  uint64_t word;
+
+  if(set == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: BitSet cannot be NULL!");
+
+  if(from < 0)
+    from = 0;
+
+  if(WORD_OF(from) >= set->numOfWord)
+    return -1;
+
+  word = set->word[WORD_OF(from)] & (~(uint64_t)0 << (from % BITS_PER_WORD));
+  for(i = WORD_OF(from); ; ){
+    if(word != 0)
+      return i * BITS_PER_WORD + lowestBit(word);
+    if(++i >= set->numOfWord)
+      return -1;
+    word = set->word[i];
+  }
+}
+
+/**
+ * bitSetUnion
+ *  destSet = destSet | srcSet
+ *  return 1 when destSet was changed, which tell a dataflow loop
+ *  whether it has to go another round
+ */
+int bitSetUnion(BitSet* destSet, BitSet* srcSet){
+  int i;
+  uint64_t changed = 0, oldWord;
+
+  if(destSet == NULL || srcSet == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: BitSet cannot be NULL!");
+
+  if(destSet->numOfWord < srcSet->numOfWord)
+    growBitSet(destSet, srcSet->numOfWord);
+
+  for(i = 0; i < srcSet->numOfWord; i++){
+    oldWord = destSet->word[i];
+    destSet->word[i] |= srcSet->word[i];
+    changed |= oldWord ^ destSet->word[i];
+  }
+  return changed != 0;
+}
+
+/**
+ * bitSetIntersect
+ *  destSet = destSet & srcSet
+ */
+void bitSetIntersect(BitSet* destSet, BitSet* srcSet){
+  int i;
+
+  if(destSet == NULL || srcSet == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: BitSet cannot be NULL!");
+
+  for(i = 0; i < destSet->numOfWord; i++)
+    destSet->word[i] &= i < srcSet->numOfWord ? srcSet->word[i] : 0;
+}
+
+/**
+ * bitSetDifference
+ *  destSet = destSet & ~srcSet
+ */
+void bitSetDifference(BitSet* destSet, BitSet* srcSet){
+  int i, numOfWord;
+
+  if(destSet == NULL || srcSet == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: BitSet cannot be NULL!");
+
+  numOfWord = destSet->numOfWord < srcSet->numOfWord ? destSet->numOfWord : srcSet->numOfWord;
+  for(i = 0; i < numOfWord; i++)
+    destSet->word[i] &= ~srcSet->word[i];
+}
+
+/**
+ * createSparseSet
+ *  Calling the function will generate an empty SparseSet and return it
+ *
+ *  universe  every member will be smaller than universe, the SparseSet
+ *            grow when a bigger number is added
+ */
+SparseSet* createSparseSet(int universe){
+  SparseSet* newSet = memAlloc(MEM_LIST, sizeof(SparseSet));
+  assert(newSet != NULL);
+
+  if(universe < BITS_PER_WORD)
+    universe = BITS_PER_WORD;
+
+  newSet->dense     = memAlloc(MEM_LIST, sizeof(int) * universe);
+  newSet->sparse    = memAlloc(MEM_LIST, sizeof(int) * universe);
+  newSet->length    = 0;
+  newSet->universe  = universe;
+
+  return newSet;
+}
+
+static void growSparseSet(SparseSet* set, int universe){
+  int newUniverse = set->universe * 2;
+  if(newUniverse < universe)
+    newUniverse = universe;
+
+  set->dense  = memRealloc(MEM_LIST, set->dense, sizeof(int) * set->universe, sizeof(int) * newUniverse);
+  set->sparse = memRealloc(MEM_LIST, set->sparse, sizeof(int) * set->universe, sizeof(int) * newUniverse);
+  assert(set->dense != NULL && set->sparse != NULL);
+  set->universe = newUniverse;
+}
+
+int sparseSetHas(SparseSet* set, int number){
+  if(set == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: SparseSet cannot be NULL!");
+
+  if(number < 0 || number >= set->universe)
+    return 0;
+
+  return (unsigned)set->sparse[number] < (unsigned)set->length && \
+         set->dense[set->sparse[number]] == number;
+}
+
+void sparseSetAdd(SparseSet* set, int number){
+  if(set == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: SparseSet cannot be NULL!");
+
+  if(number < 0)
+    ThrowError(ERR_INDEX_OUT_OF_RANGE, "Number %d cannot be put into a SparseSet", number);
+
+  if(number >= set->universe)
+    growSparseSet(set, number + 1);
+
+  if(sparseSetHas(set, number))
+    return;
+
+  set->sparse[number]       = set->length;
+  set->dense[set->length++] = number;
+}
+
+/**
+ * sparseSetRemove
+ *  the last member is moved into the place of the removed one
+ */
+void sparseSetRemove(SparseSet* set, int number){
+  int lastNumber;
+
+  if(!sparseSetHas(set, number))
+    return;
+
+  lastNumber = set->dense[--set->length];
+  set->dense[set->sparse[number]] = lastNumber;
+  set->sparse[lastNumber]         = set->sparse[number];
+}
+
+void sparseSetClear(SparseSet* set){
+  if(set == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: SparseSet cannot be NULL!");
+
+  set->length = 0;
+}
+
+void destroyBitSet(BitSet* set){
+  if(set == NULL)
+    return;
+
+  memFree(MEM_LIST, set->word, sizeof(uint64_t) * set->numOfWord);
+  memFree(MEM_LIST, set, sizeof(BitSet));
+}
+
+void destroySparseSet(SparseSet* set){
+  if(set == NULL)
+    return;
+
+  memFree(MEM_LIST, set->dense, sizeof(int) * set->universe);
+  memFree(MEM_LIST, set->sparse, sizeof(int) * set->universe);
+  memFree(MEM_LIST, set, sizeof(SparseSet));
+}
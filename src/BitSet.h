@@ -0,0 +1,79 @@
+#ifndef BitSet_H
+#define BitSet_H
+
+#include <stdint.h>
+#include "ErrorObject.h"
+
+#define BITS_PER_WORD   64
+
+/**
+ * BitSet
+ *
+ *  Object of BitSet's type is a dense set of small non-negative number
+ *  (node id, variable name ...). Every number own one bit inside an array
+ *  of 64-bit word, so union, intersect and difference work on 64 member
+ *  at a time. The loops are plain word loops the compiler can vectorize.
+ *
+ *  BitSet contain:
+ *    1. word       the array of word, bit (n % 64) of word[n / 64] is n
+ *    2. numOfWord  number of word in the array
+ *
+ *  The BitSet grow by itself when a bigger number is added.
+ *
+ *  Loop over a BitSet:
+ *    for(n = bitSetNext(set, 0); n >= 0; n = bitSetNext(set, n + 1))
+ */
+typedef struct{
+  uint64_t* word;
+  int numOfWord;
+}BitSet;
+
+/**
+ * SparseSet
+ *
+ *  Briggs-Torczon sparse set. Add, remove, member test and clear are O(1)
+ *  and the member can be looped in the order they were added, so a set
+ *  that is emptied again and again never has to be cleared word by word.
+ *
+ *  SparseSet contain:
+ *    1. dense      the member, dense[0] .. dense[length - 1]
+ *    2. sparse     sparse[n] is the position of n inside dense
+ *    3. length     number of member
+ *    4. universe   every member is smaller than universe
+ *
+ *  n is a member only when sparse[n] < length and dense[sparse[n]] == n,
+ *  so sparse never need to be initialised.
+ *
+ *  Loop over a SparseSet:
+ *    for(i = 0; i < set->length; i++)
+ *      n = set->dense[i];
+ */
+typedef struct{
+  int* dense;
+  int* sparse;
+  int length;
+  int universe;
+}SparseSet;
+
+BitSet* createBitSet(int numOfBit);
+void bitSetAdd(BitSet* set, int number);
+void bitSetRemove(BitSet* set, int number);
+int bitSetHas(BitSet* set, int number);
+void bitSetClear(BitSet* set);
+int bitSetCount(BitSet* set);
+int bitSetNext(BitSet* set, int from);
+
+int bitSetUnion(BitSet* destSet, BitSet* srcSet);
+void bitSetIntersect(BitSet* destSet, BitSet* srcSet);
+void bitSetDifference(BitSet* destSet, BitSet* srcSet);
+
+SparseSet* createSparseSet(int universe);
+void sparseSetAdd(SparseSet* set, int number);
+void sparseSetRemove(SparseSet* set, int number);
+int sparseSetHas(SparseSet* set, int number);
+void sparseSetClear(SparseSet* set);
+
+void destroyBitSet(BitSet* set);
+void destroySparseSet(SparseSet* set);
+
+#endif // BitSet_H
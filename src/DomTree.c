@@ -0,0 +1,174 @@
+#include "DomTree.h"
+#include "Allocator.h"
+#include <stdlib.h>
+
+static int* createIndexArray(int length){
+  return memAlloc(MEM_LIST, sizeof(int) * (length + 1));
+}
+
+static void destroyIndexArray(int* array, int length){
+  memFree(MEM_LIST, array, sizeof(int) * (length + 1));
+}
+
+/*
+ *  fillChildren
+ *  Turn the imdDom of (n) node into children in CSR form, the children
+ *  of a node are put in increasing number
+ */
+static void fillChildren(int n, int* imdDom, int* childStart, int* child){
+  int k;
+
+  for(k = 0; k <= n; k++)
+    childStart[k] = 0;
+  for(k = 0; k < n; k++)
+    if(imdDom[k] != NOT_IN_DOM_TREE)
+      childStart[imdDom[k] + 1]++;
+  for(k = 0; k < n; k++)
+    childStart[k + 1] += childStart[k];
+  for(k = 0; k < n; k++)
+    if(imdDom[k] != NOT_IN_DOM_TREE)
+      child[childStart[imdDom[k]]++] = k;
+  for(k = n; k > 0; k--)
+    childStart[k] = childStart[k - 1];
+  childStart[0] = 0;
+}
+
+/**
+ *  createDomTree
+ *  Build the dominator tree of every node reachable from (rootNode). The
+ *  imdDom of the nodes must be set first (setAllImdDom, setAllImdDomWith
+ *  ...), a reachable node without imdDom throw ERR_NULL_NODE.
+ */
+DomTree* createDomTree(Node** rootNode){
+  if(rootNode == NULL || *rootNode == NULL)
+    ThrowError(ERR_NULL_NODE, "Empty Tree input detected!");
+
+  Vector* order       = getNodeOrder(*rootNode, ORDER_RPO);
+  int n               = order->length;
+  int* rpoImdDom      = createIndexArray(n);
+  Node* nodePtr;
+  int k, r, top, pre, post;
+
+  numberNodes(order, INDEX_ORDER);
+
+  rpoImdDom[0] = NOT_IN_DOM_TREE;
+  for(k = 1; k < n; k++){
+    nodePtr = order->item[k];
+    if(nodePtr->imdDom == NULL || getNodeIndex(order, nodePtr->imdDom, INDEX_ORDER) == NOT_NUMBERED){
+      destroyIndexArray(rpoImdDom, n);
+      ThrowError(ERR_NULL_NODE, "imdDom of node %d is not set", nodePtr->id);
+    }
+    rpoImdDom[k] = nodePtr->imdDom->nodeIndex[INDEX_ORDER];
+  }
+
+  int* rpoChildStart  = createIndexArray(n);
+  int* rpoChild       = createIndexArray(n);
+  int* stack          = createIndexArray(n);
+  int* nextChild      = createIndexArray(n);
+  int* preNum         = createIndexArray(n);
+  DomTree* tree       = memAlloc(MEM_LIST, sizeof(DomTree));
+  tree->numOfNode     = n;
+  tree->node          = memAlloc(MEM_LIST, sizeof(Node*) * n);
+  tree->imdDom        = createIndexArray(n);
+  tree->childStart    = createIndexArray(n);
+  tree->child         = createIndexArray(n);
+  tree->postNum       = createIndexArray(n);
+  tree->level         = createIndexArray(n);
+
+  /*  depth first walk of the tree give the entry and exit number */
+  fillChildren(n, rpoImdDom, rpoChildStart, rpoChild);
+  pre = post = top = 0;
+  preNum[0]     = pre++;
+  nextChild[0]  = rpoChildStart[0];
+  stack[top++]  = 0;
+  while(top > 0){
+    r = stack[top - 1];
+    if(nextChild[r] == rpoChildStart[r + 1]){
+      tree->postNum[preNum[r]] = post++;
+      top--;
+      continue;
+    }
+
+    k = rpoChild[nextChild[r]++];
+    preNum[k]     = pre++;
+    nextChild[k]  = rpoChildStart[k];
+    stack[top++]  = k;
+  }
+
+  /*  every array of the tree is by preorder number */
+  for(k = 0; k < n; k++)
+    tree->node[preNum[k]] = order->item[k];
+  for(k = 0; k < n; k++){
+    tree->node[k]->nodeIndex[INDEX_DOM_TREE] = k;
+    r = tree->node[k]->nodeIndex[INDEX_ORDER];
+    tree->imdDom[k] = rpoImdDom[r] == NOT_IN_DOM_TREE ? NOT_IN_DOM_TREE : preNum[rpoImdDom[r]];
+  }
+  fillChildren(n, tree->imdDom, tree->childStart, tree->child);
+  tree->level[0] = 0;
+  for(k = 1; k < n; k++)
+    tree->level[k] = tree->level[tree->imdDom[k]] + 1;
+
+  destroyIndexArray(rpoImdDom, n);
+  destroyIndexArray(rpoChildStart, n);
+  destroyIndexArray(rpoChild, n);
+  destroyIndexArray(stack, n);
+  destroyIndexArray(nextChild, n);
+  destroyIndexArray(preNum, n);
+  return tree;
+}
+
+void destroyDomTree(DomTree* tree){
+  if(tree == NULL)
+    return;
+
+  memFree(MEM_LIST, tree->node, sizeof(Node*) * tree->numOfNode);
+  destroyIndexArray(tree->imdDom, tree->numOfNode);
+  destroyIndexArray(tree->childStart, tree->numOfNode);
+  destroyIndexArray(tree->child, tree->numOfNode);
+  destroyIndexArray(tree->postNum, tree->numOfNode);
+  destroyIndexArray(tree->level, tree->numOfNode);
+  memFree(MEM_LIST, tree, sizeof(DomTree));
+}
+
+/**
+ *  domTreeIndexOf
+ *  return the preorder number of (node), NOT_IN_DOM_TREE when the node
+ *  cannot be reached from the root
+ */
+int domTreeIndexOf(DomTree* tree, Node* node){
+  int p;
+
+  if(tree == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: DomTree cannot be NULL!");
+
+  if(node == NULL)
+    return NOT_IN_DOM_TREE;
+
+  p = node->nodeIndex[INDEX_DOM_TREE];
+  if(p < 0 || p >= tree->numOfNode || tree->node[p] != node)
+    return NOT_IN_DOM_TREE;
+  return p;
+}
+
+/**
+ *  dominates
+ *  return 1 when every path from the root to (nodeB) go through (nodeA),
+ *  a node dominate itself
+ */
+int dominates(DomTree* tree, Node* nodeA, Node* nodeB){
+  int a = domTreeIndexOf(tree, nodeA);
+  int b = domTreeIndexOf(tree, nodeB);
+
+  if(a == NOT_IN_DOM_TREE || b == NOT_IN_DOM_TREE)
+    return 0;
+
+  return a <= b && tree->postNum[b] <= tree->postNum[a];
+}
+
+/**
+ *  strictlyDominates
+ *  same as dominates, but a node does not strictly dominate itself
+ */
+int strictlyDominates(DomTree* tree, Node* nodeA, Node* nodeB){
+  return nodeA != nodeB && dominates(tree, nodeA, nodeB);
+}
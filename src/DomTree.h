@@ -0,0 +1,66 @@
+#ifndef DomTree_H
+#define DomTree_H
+
+#include "ErrorObject.h"
+#include "BitSet.h"
+#include "NodeChain.h"
+
+#define NOT_IN_DOM_TREE  -1
+
+/**
+ * DomTree
+ *
+ *  Object of DomTree's type is the dominator tree of a CFG, built from
+ *  the imdDom of every node reachable from the root. The nodes are
+ *  numbered in preorder of the tree, so the subtree of a node is one
+ *  range of number and a dominance question is two compare.
+ *
+ *  DomTree contain:
+ *    1. numOfNode    number of node in the tree
+ *    2. node         node[p] is the node with preorder number p, node[0]
+ *                    is the root
+ *    3. imdDom       preorder number of the imdDom, NOT_IN_DOM_TREE for
+ *                    the root
+ *    4. childStart   the children of p are child[childStart[p]] ..
+ *    5. child          child[childStart[p + 1] - 1], in preorder
+ *    6. postNum      postNum[p] is the exit number of p, a node exit
+ *                    after every node it dominates
+ *    7. level        depth of p in the tree, 0 for the root
+ *
+ *        A            p   node  imdDom  child  postNum  level
+ *      / | \          0    A      -     1 2 4     4       0
+ *     B  C  E         1    B      0     -         0       1
+ *        |            2    C      0     3         2       1
+ *        D            3    D      2     -         1       2
+ *                     4    E      0     -         3       1
+ *
+ *  a dominate b when  p(a) <= p(b)  and  postNum[p(b)] <= postNum[p(a)]
+ *
+ *  Loop over the dominator tree in preorder:
+ *    for(p = 0; p < tree->numOfNode; p++)
+ *      nodePtr = tree->node[p];
+ *
+ *  The preorder number of a node is kept in its nodeIndex of
+ *  INDEX_DOM_TREE, domTreeIndexOf give it back.
+ *
+ *  The DomTree does not follow a later change of imdDom, build it again
+ *  after setting the dominator.
+ */
+typedef struct{
+  int numOfNode;
+  Node** node;
+  int* imdDom;
+  int* childStart;
+  int* child;
+  int* postNum;
+  int* level;
+}DomTree;
+
+DomTree* createDomTree(Node** rootNode);
+void destroyDomTree(DomTree* tree);
+
+int domTreeIndexOf(DomTree* tree, Node* node);
+int dominates(DomTree* tree, Node* nodeA, Node* nodeB);
+int strictlyDominates(DomTree* tree, Node* nodeA, Node* nodeB);
+
+#endif // DomTree_H
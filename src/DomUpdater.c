@@ -0,0 +1,705 @@
+#include "DomUpdater.h"
+#include "Dominator.h"
+#include "Allocator.h"
+#include <stdlib.h>
+
+#define NOT_PROCESSED         -1
+#define NEXT_CHILD_CAPACITY   64
+
+/*
+ *  findSlot
+ *  Slot of (node) inside the updater, NOT_NUMBERED when it was never
+ *  reached
+ */
+static int findSlot(DomUpdater* updater, Node* node){
+  return getNodeIndex(updater->node, node, INDEX_UPDATER);
+}
+
+/*
+ *  giveSlot
+ *  Slot of (node), a node met for the first time get the next one and
+ *  the arrays grow to hold it, it is not reached yet
+ */
+static int giveSlot(DomUpdater* updater, Node* node){
+  int slot = addNumberedNode(updater->node, node, INDEX_UPDATER);
+  int newCapacity, k;
+
+  if(slot < updater->capacity)
+    return slot;
+
+  newCapacity = updater->capacity * 2;
+  if(newCapacity <= slot)
+    newCapacity = slot + 1;
+
+  updater->level    = memRealloc(MEM_LIST, updater->level, sizeof(int) * updater->capacity, \
+                                 sizeof(int) * newCapacity);
+  updater->domChild = memRealloc(MEM_LIST, updater->domChild, sizeof(Vector*) * updater->capacity, \
+                                 sizeof(Vector*) * newCapacity);
+  for(k = updater->capacity; k < newCapacity; k++){
+    updater->level[k]     = NOT_REACHED;
+    updater->domChild[k]  = NULL;
+  }
+  updater->capacity = newCapacity;
+  return slot;
+}
+
+static int levelOf(DomUpdater* updater, Node* node){
+  int slot = findSlot(updater, node);
+  return slot == NOT_NUMBERED ? NOT_REACHED : updater->level[slot];
+}
+
+static void setLevel(DomUpdater* updater, Node* node, int level){
+  int slot = giveSlot(updater, node);
+  updater->level[slot] = level;
+}
+
+/*
+ *  domChildOf
+ *  The nodes (node) is the imdDom of, NULL when there is none
+ */
+static Vector* domChildOf(DomUpdater* updater, Node* node){
+  int slot = findSlot(updater, node);
+  return slot == NOT_NUMBERED ? NULL : updater->domChild[slot];
+}
+
+static void linkDomChild(DomUpdater* updater, Node* domNode, Node* node){
+  int slot = giveSlot(updater, domNode);
+
+  if(updater->domChild[slot] == NULL)
+    updater->domChild[slot] = createVector(0);
+  vectorAddLast(updater->domChild[slot], node);
+}
+
+/*
+ *  The scratch sets of the updater hold the slot of reached node
+ */
+static void slotSetAdd(DomUpdater* updater, SparseSet* set, Node* node){
+  sparseSetAdd(set, findSlot(updater, node));
+}
+
+static int slotSetHas(DomUpdater* updater, SparseSet* set, Node* node){
+  int slot = findSlot(updater, node);
+  return slot != NOT_NUMBERED && sparseSetHas(set, slot);
+}
+
+/*
+ *  unlinkDomChild
+ *  The order of domChild does not matter, the last one take the place
+ *  of the removed one
+ */
+static void unlinkDomChild(DomUpdater* updater, Node* domNode, Node* node){
+  Vector* domChild = domChildOf(updater, domNode);
+  int position     = vectorFind(domChild, node);
+
+  domChild->item[position] = VECTOR_LAST(domChild);
+  domChild->length--;
+}
+
+/*
+ *  markStale
+ *  A node never reached has no domFrontiers to find again
+ */
+static void markStale(DomUpdater* updater, Node* node){
+  int slot = findSlot(updater, node);
+
+  if(slot != NOT_NUMBERED)
+    bitSetAdd(updater->staleSet, slot);
+}
+
+/*
+ *  markStaleUpTo
+ *  Mark (node) and its dominators up to, but not including, (stopNode)
+ */
+static void markStaleUpTo(DomUpdater* updater, Node* node, Node* stopNode){
+  for(; node != NULL && node != stopNode; node = node->imdDom)
+    markStale(updater, node);
+}
+
+/*
+ *  findNca
+ *  Nearest common dominator of two reached node, the deeper one is moved
+ *  up until both meet
+ */
+static Node* findNca(DomUpdater* updater, Node* nodeA, Node* nodeB){
+  while(nodeA != nodeB){
+    if(levelOf(updater, nodeA) >= levelOf(updater, nodeB))
+      nodeA = nodeA->imdDom;
+    else
+      nodeB = nodeB->imdDom;
+  }
+  return nodeA;
+}
+
+/*
+ *  setSubtreeLevel
+ *  (node) is now at (level), so is every node it dominate one deeper
+ */
+static void setSubtreeLevel(DomUpdater* updater, Node* node, int level){
+  Vector* stack = createVector(0);
+  Vector* domChild;
+  int i;
+
+  setLevel(updater, node, level);
+  vectorAddLast(stack, node);
+  while(stack->length > 0){
+    node      = vectorRemoveLast(stack);
+    domChild  = domChildOf(updater, node);
+    for(i = 0; domChild != NULL && i < domChild->length; i++){
+      setLevel(updater, domChild->item[i], levelOf(updater, node) + 1);
+      vectorAddLast(stack, domChild->item[i]);
+    }
+  }
+  destroyVector(stack);
+}
+
+/*
+ *  The bucket of the depth based search, a heap giving back the deepest
+ *  node first
+ */
+static void bucketPush(DomUpdater* updater, Vector* bucket, Node* node){
+  int k = bucket->length, parentNum;
+
+  vectorAddLast(bucket, node);
+  while(k > 0){
+    parentNum = (k - 1) / 2;
+    if(levelOf(updater, bucket->item[parentNum]) >= levelOf(updater, node))
+      break;
+    bucket->item[k] = bucket->item[parentNum];
+    k = parentNum;
+  }
+  bucket->item[k] = node;
+}
+
+static Node* bucketPop(DomUpdater* updater, Vector* bucket){
+  Node* topNode   = bucket->item[0];
+  Node* lastNode  = vectorRemoveLast(bucket);
+  int k = 0, childNum;
+
+  if(bucket->length == 0)
+    return topNode;
+
+  while((childNum = 2 * k + 1) < bucket->length){
+    if(childNum + 1 < bucket->length && \
+       levelOf(updater, bucket->item[childNum + 1]) > levelOf(updater, bucket->item[childNum]))
+      childNum++;
+    if(levelOf(updater, lastNode) >= levelOf(updater, bucket->item[childNum]))
+      break;
+    bucket->item[k] = bucket->item[childNum];
+    k = childNum;
+  }
+  bucket->item[k] = lastNode;
+  return topNode;
+}
+
+/*
+ *  insertReachable
+ *  The edge (fromNode) -> (toNode) was added and both were already
+ *  reached. A node v can only change when depth(nca) + 1 < depth(v) and
+ *  a path from toNode to v never go above depth(v). They are taken out
+ *  of the bucket from the deepest, a successor deeper than the current
+ *  one is not affected itself but the search go on through it.
+ */
+static void insertReachable(DomUpdater* updater, Node* fromNode, Node* toNode){
+  Node* ncaNode   = findNca(updater, fromNode, toNode);
+  int ncaLevel    = levelOf(updater, ncaNode);
+  Vector *bucket, *affected, *unaffected;
+  SparseSet* visited;
+  Node *nodePtr, *childPtr;
+  int i, k, currentLevel, childLevel;
+
+  /*  a back edge into y put y in the domFrontiers of y as well */
+  markStaleUpTo(updater, fromNode, ncaNode == toNode ? toNode->imdDom : ncaNode);
+  if(ncaLevel + 1 >= levelOf(updater, toNode))
+    return;
+
+  bucket      = createVector(0);
+  affected    = createVector(0);
+  unaffected  = createVector(0);
+  visited     = createSparseSet(updater->capacity);
+  slotSetAdd(updater, visited, toNode);
+  bucketPush(updater, bucket, toNode);
+
+  while(bucket->length > 0){
+    nodePtr       = bucketPop(updater, bucket);
+    currentLevel  = levelOf(updater, nodePtr);
+    vectorAddLast(affected, nodePtr);
+
+    while(1){
+      for(i = 0; i < nodePtr->numOfChild; i++){
+        childPtr    = nodePtr->children[i];
+        childLevel  = levelOf(updater, childPtr);
+        if(childLevel <= ncaLevel + 1 || slotSetHas(updater, visited, childPtr))
+          continue;
+        slotSetAdd(updater, visited, childPtr);
+
+        if(childLevel > currentLevel)
+          vectorAddLast(unaffected, childPtr);
+        else
+          bucketPush(updater, bucket, childPtr);
+      }
+      if(unaffected->length == 0)
+        break;
+      nodePtr = vectorRemoveLast(unaffected);
+    }
+  }
+
+  /*  the dominators an affected node leave behind lose part of their subtree */
+  for(k = 0; k < affected->length; k++)
+    markStaleUpTo(updater, ((Node*)affected->item[k])->imdDom, ncaNode);
+  for(k = 0; k < affected->length; k++){
+    nodePtr = affected->item[k];
+    unlinkDomChild(updater, nodePtr->imdDom, nodePtr);
+    nodePtr->imdDom = ncaNode;
+    linkDomChild(updater, ncaNode, nodePtr);
+  }
+  for(k = 0; k < affected->length; k++)
+    setSubtreeLevel(updater, affected->item[k], ncaLevel + 1);
+
+  destroyVector(bucket);
+  destroyVector(affected);
+  destroyVector(unaffected);
+  destroySparseSet(visited);
+}
+
+/*
+ *  inRegion
+ *  The nodes whose dominators are found again: the nodes of (regionSet),
+ *  or the nodes not reached when there is no regionSet
+ */
+static int inRegion(DomUpdater* updater, Node* node, SparseSet* regionSet){
+  if(regionSet == NULL)
+    return levelOf(updater, node) == NOT_REACHED;
+  return slotSetHas(updater, regionSet, node);
+}
+
+/*
+ *  findRegionDominators
+ *  setAllImdDomIterative on the nodes reached from (topNode) through
+ *  inRegion nodes only. (order) is filled in reverse postorder with
+ *  topNode first and numbered with INDEX_ORDER, imdDom[b] is the
+ *  position of the imdDom of order[b].
+ *
+ *  return imdDom, free it with sizeof(int) * (order->length + 1)
+ */
+static int* findRegionDominators(DomUpdater* updater, Node* topNode, SparseSet* regionSet, Vector* order){
+  Vector* stack     = createVector(0);
+  Vector* visited   = createVector(0);
+  int capacity      = NEXT_CHILD_CAPACITY;
+  int* nextChild    = memAlloc(MEM_LIST, sizeof(int) * capacity);
+  int *imdDom, b, i, pred, newImdDom, changed;
+  Node *nodePtr, *childPtr;
+
+  nextChild[addNumberedNode(visited, topNode, INDEX_ORDER)] = 0;
+  vectorAddLast(stack, topNode);
+  while(stack->length > 0){
+    nodePtr = VECTOR_LAST(stack);
+    b       = nodePtr->nodeIndex[INDEX_ORDER];
+    if(nextChild[b] == nodePtr->numOfChild){
+      vectorAddLast(order, vectorRemoveLast(stack));
+      continue;
+    }
+    childPtr = nodePtr->children[nextChild[b]++];
+    if(getNodeIndex(visited, childPtr, INDEX_ORDER) == NOT_NUMBERED && inRegion(updater, childPtr, regionSet)){
+      if(visited->length == capacity){
+        nextChild = memRealloc(MEM_LIST, nextChild, sizeof(int) * capacity, sizeof(int) * capacity * 2);
+        capacity *= 2;
+      }
+      nextChild[addNumberedNode(visited, childPtr, INDEX_ORDER)] = 0;
+      vectorAddLast(stack, childPtr);
+    }
+  }
+  memFree(MEM_LIST, nextChild, sizeof(int) * capacity);
+  destroyVector(stack);
+  destroyVector(visited);
+
+  /*  postorder to reverse postorder, then number the nodes by it */
+  for(b = 0; b < order->length / 2; b++){
+    nodePtr = order->item[b];
+    order->item[b] = order->item[order->length - 1 - b];
+    order->item[order->length - 1 - b] = nodePtr;
+  }
+  numberNodes(order, INDEX_ORDER);
+  imdDom = memAlloc(MEM_LIST, sizeof(int) * (order->length + 1));
+  for(b = 0; b < order->length; b++)
+    imdDom[b] = NOT_PROCESSED;
+  imdDom[0] = 0;
+
+  do{
+    changed = 0;
+    for(b = 1; b < order->length; b++){
+      nodePtr   = order->item[b];
+      newImdDom = NOT_PROCESSED;
+      for(i = 0; i < nodePtr->numOfDirectDom; i++){
+        pred = getNodeIndex(order, nodePtr->directDom[i], INDEX_ORDER);
+        if(pred == NOT_NUMBERED || imdDom[pred] == NOT_PROCESSED)
+          continue;
+
+        if(newImdDom == NOT_PROCESSED)
+          newImdDom = pred;
+        else{
+          while(pred != newImdDom){
+            while(pred > newImdDom)
+              pred = imdDom[pred];
+            while(newImdDom > pred)
+              newImdDom = imdDom[newImdDom];
+          }
+        }
+      }
+      if(imdDom[b] != newImdDom){
+        imdDom[b] = newImdDom;
+        changed   = 1;
+      }
+    }
+  }while(changed);
+
+  return imdDom;
+}
+
+/*
+ *  attachRegion
+ *  Give the nodes found by findRegionDominators their imdDom, level and
+ *  place in domChild, order[0] is already in place
+ */
+static void attachRegion(DomUpdater* updater, Vector* order, int* imdDom){
+  Node* nodePtr;
+  int b;
+
+  for(b = 1; b < order->length; b++){
+    nodePtr         = order->item[b];
+    nodePtr->imdDom = order->item[imdDom[b]];
+    linkDomChild(updater, nodePtr->imdDom, nodePtr);
+    setLevel(updater, nodePtr, levelOf(updater, nodePtr->imdDom) + 1);
+    markStale(updater, nodePtr);
+  }
+}
+
+/*
+ *  insertUnreachable
+ *  (toNode) was not reached before the edge (fromNode) -> (toNode), so
+ *  every node it make reachable is entered through it. The new part get
+ *  its dominators with toNode as root, then its edges going back into the
+ *  old part are added one by one.
+ */
+static void insertUnreachable(DomUpdater* updater, Node* fromNode, Node* toNode){
+  Vector* order       = createVector(0);
+  Vector* pending     = createVector(0);
+  int* imdDom         = findRegionDominators(updater, toNode, NULL, order);
+  Node* nodePtr;
+  int b, i;
+
+  /*  the edges from the new part to the nodes reached before */
+  for(b = 0; b < order->length; b++){
+    nodePtr = order->item[b];
+    for(i = 0; i < nodePtr->numOfChild; i++)
+      if(levelOf(updater, nodePtr->children[i]) != NOT_REACHED){
+        vectorAddLast(pending, nodePtr);
+        vectorAddLast(pending, nodePtr->children[i]);
+      }
+  }
+
+  toNode->imdDom = fromNode;
+  linkDomChild(updater, fromNode, toNode);
+  setLevel(updater, toNode, levelOf(updater, fromNode) + 1);
+  markStale(updater, toNode);
+  attachRegion(updater, order, imdDom);
+
+  for(b = 0; b < pending->length; b += 2)
+    insertReachable(updater, pending->item[b], pending->item[b + 1]);
+
+  memFree(MEM_LIST, imdDom, sizeof(int) * (order->length + 1));
+  destroyVector(order);
+  destroyVector(pending);
+}
+
+/*
+ *  redoSubtree
+ *  Find again the dominators of the subtree of (topNode) from topNode, a
+ *  node of the subtree not reached any more lose its imdDom and is put
+ *  into (lost) when it is given.
+ */
+static void redoSubtree(DomUpdater* updater, Node* topNode, Vector* lost){
+  Vector* subtree       = createVector(0);
+  Vector* order         = createVector(0);
+  SparseSet* regionSet  = createSparseSet(updater->capacity);
+  Vector* domChild;
+  Node* nodePtr;
+  int *imdDom, k, i;
+
+  /*  the old subtree, a deeper node outside it keep its imdDom */
+  vectorAddLast(subtree, topNode);
+  for(k = 0; k < subtree->length; k++){
+    domChild = domChildOf(updater, subtree->item[k]);
+    for(i = 0; domChild != NULL && i < domChild->length; i++){
+      slotSetAdd(updater, regionSet, domChild->item[i]);
+      vectorAddLast(subtree, domChild->item[i]);
+    }
+  }
+
+  imdDom = findRegionDominators(updater, topNode, regionSet, order);
+  for(k = 0; k < subtree->length; k++){
+    nodePtr   = subtree->item[k];
+    domChild  = domChildOf(updater, nodePtr);
+    if(domChild != NULL)
+      domChild->length = 0;
+    if(k > 0 && getNodeIndex(order, nodePtr, INDEX_ORDER) == NOT_NUMBERED){
+      nodePtr->imdDom = NULL;
+      setLevel(updater, nodePtr, NOT_REACHED);
+      markStale(updater, nodePtr);
+      if(lost != NULL)
+        vectorAddLast(lost, nodePtr);
+    }
+  }
+  attachRegion(updater, order, imdDom);
+
+  memFree(MEM_LIST, imdDom, sizeof(int) * (order->length + 1));
+  destroyVector(subtree);
+  destroyVector(order);
+  destroySparseSet(regionSet);
+}
+
+/*
+ *  deleteReachable
+ *  The edge (fromNode) -> (toNode) was removed. A path to a node the nca
+ *  dominate has to go through the nca, so only the subtree of the nca
+ *  can change, unless part of it is no longer reached. The edges leaving
+ *  that part are then gone as well, the subtree of the nca of their
+ *  successors is done again.
+ */
+static void deleteReachable(DomUpdater* updater, Node* fromNode, Node* toNode){
+  Node* ncaNode = findNca(updater, fromNode, toNode);
+  Vector* lost;
+  Node *nodePtr, *childPtr;
+  int k, i;
+
+  /*  y dominate x, the edge was a back edge into y */
+  if(ncaNode == toNode){
+    markStaleUpTo(updater, fromNode, toNode->imdDom);
+    return;
+  }
+
+  lost = createVector(0);
+  redoSubtree(updater, ncaNode, lost);
+  if(lost->length > 0){
+    for(k = 0; k < lost->length; k++){
+      nodePtr = lost->item[k];
+      for(i = 0; i < nodePtr->numOfChild; i++){
+        childPtr = nodePtr->children[i];
+        if(levelOf(updater, childPtr) != NOT_REACHED)
+          ncaNode = findNca(updater, ncaNode, childPtr);
+      }
+    }
+    redoSubtree(updater, ncaNode, NULL);
+
+    /*  a node no longer reached take its edges out of the domFrontiers above */
+    markStaleUpTo(updater, ncaNode, NULL);
+  }
+  destroyVector(lost);
+}
+
+/**
+ *  createDomUpdater
+ *  Set the imdDom of every node reachable from (rootNode) with
+ *  setAllImdDomSemiNCA and remember the dominator tree. The domFrontiers
+ *  already found are taken as up to date.
+ */
+DomUpdater* createDomUpdater(Node** rootNode){
+  if(rootNode == NULL || *rootNode == NULL)
+    ThrowError(ERR_NULL_NODE, "Empty Tree input detected!");
+
+  DomUpdater* updater = memAlloc(MEM_LIST, sizeof(DomUpdater));
+  Vector* order;
+  Node* nodePtr;
+  int k;
+
+  setAllImdDomSemiNCA(rootNode);
+  order               = getNodeOrder(*rootNode, ORDER_RPO);
+  updater->root       = *rootNode;
+  updater->capacity   = order->length;
+  updater->node       = createVector(order->length);
+  updater->level      = memAlloc(MEM_LIST, sizeof(int) * updater->capacity);
+  updater->domChild   = memAlloc(MEM_LIST, sizeof(Vector*) * updater->capacity);
+  updater->staleSet   = createBitSet(updater->capacity);
+  for(k = 0; k < updater->capacity; k++){
+    updater->level[k]     = NOT_REACHED;
+    updater->domChild[k]  = NULL;
+  }
+
+  setLevel(updater, *rootNode, 0);
+  for(k = 1; k < order->length; k++){
+    nodePtr = order->item[k];
+    setLevel(updater, nodePtr, levelOf(updater, nodePtr->imdDom) + 1);
+    linkDomChild(updater, nodePtr->imdDom, nodePtr);
+  }
+  return updater;
+}
+
+void destroyDomUpdater(DomUpdater* updater){
+  int k;
+
+  if(updater == NULL)
+    return;
+
+  for(k = 0; k < updater->capacity; k++)
+    destroyVector(updater->domChild[k]);
+  destroyVector(updater->node);
+  memFree(MEM_LIST, updater->level, sizeof(int) * updater->capacity);
+  memFree(MEM_LIST, updater->domChild, sizeof(Vector*) * updater->capacity);
+  destroyBitSet(updater->staleSet);
+  memFree(MEM_LIST, updater, sizeof(DomUpdater));
+}
+
+/**
+ *  domUpdaterAddChild
+ *  addChild, then bring the imdDom of the nodes it change up to date
+ */
+void domUpdaterAddChild(DomUpdater* updater, Node** parentNode, Node** childNode){
+  if(updater == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: DomUpdater cannot be NULL!");
+
+  addChild(parentNode, childNode);
+  markStale(updater, *parentNode);
+  if(levelOf(updater, *parentNode) == NOT_REACHED)
+    return;
+
+  if(levelOf(updater, *childNode) == NOT_REACHED)
+    insertUnreachable(updater, *parentNode, *childNode);
+  else
+    insertReachable(updater, *parentNode, *childNode);
+}
+
+/**
+ *  domUpdaterRemoveChild
+ *  removeChild, then bring the imdDom of the nodes it change up to date
+ */
+void domUpdaterRemoveChild(DomUpdater* updater, Node** parentNode, Node** childNode){
+  if(updater == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: DomUpdater cannot be NULL!");
+
+  removeChild(parentNode, childNode);
+  markStale(updater, *parentNode);
+  if(levelOf(updater, *parentNode) == NOT_REACHED || levelOf(updater, *childNode) == NOT_REACHED)
+    return;
+
+  deleteReachable(updater, *parentNode, *childNode);
+}
+
+/**
+ *  getDomLevel
+ *  return the depth of (node) in the dominator tree, NOT_REACHED when the
+ *  node cannot be reached from the root
+ */
+int getDomLevel(DomUpdater* updater, Node* node){
+  if(updater == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: DomUpdater cannot be NULL!");
+
+  if(node == NULL)
+    return NOT_REACHED;
+  return levelOf(updater, node);
+}
+
+int isDomFrontierStale(DomUpdater* updater, Node* node){
+  if(updater == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: DomUpdater cannot be NULL!");
+
+  return bitSetHas(updater->staleSet, findSlot(updater, node));
+}
+
+/**
+ *  markDomFrontierStale
+ *  Have refreshDomFrontiers find the domFrontiers of (node) again, for a
+ *  node whose domFrontiers were never found or were changed by hand
+ */
+void markDomFrontierStale(DomUpdater* updater, Node* node){
+  if(updater == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: DomUpdater cannot be NULL!");
+
+  if(node != NULL)
+    markStale(updater, node);
+}
+
+/*
+ *  addStaleRegion
+ *  Put the dominator subtree of (node) into (regionSet) and (region), a
+ *  subtree already there is not walked again
+ */
+static void addStaleRegion(DomUpdater* updater, Node* node, SparseSet* regionSet, Vector* region){
+  Vector* domChild;
+  int k = region->length, i;
+
+  if(slotSetHas(updater, regionSet, node))
+    return;
+  slotSetAdd(updater, regionSet, node);
+  vectorAddLast(region, node);
+  for(; k < region->length; k++){
+    domChild = domChildOf(updater, region->item[k]);
+    for(i = 0; domChild != NULL && i < domChild->length; i++){
+      if(slotSetHas(updater, regionSet, domChild->item[i]))
+        continue;
+      slotSetAdd(updater, regionSet, domChild->item[i]);
+      vectorAddLast(region, domChild->item[i]);
+    }
+  }
+}
+
+/**
+ *  refreshDomFrontiers
+ *  Find again the domFrontiers of every node marked stale, a node no
+ *  longer reached get NULL.
+ *
+ *  A node w has y in its domFrontiers when an edge p -> y leave the
+ *  dominator subtree of w, so only the edges going out of the subtrees of
+ *  the stale nodes (the region) are looked at. From each such p a runner
+ *  climb the imdDom up to the imdDom of y and put y into the stale nodes
+ *  it meet (Cooper, Harvey and Kennedy). Above the region there is no
+ *  stale node, so the runner stop when it leave the region. The edges
+ *  into the same y are done together, so y is put into a node only once.
+ */
+void refreshDomFrontiers(DomUpdater* updater){
+  SparseSet *regionSet, *doneSet;
+  Vector* region;
+  Node *nodePtr, *joinNode, *runner;
+  int slot, k, i, j;
+
+  if(updater == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: DomUpdater cannot be NULL!");
+
+  regionSet = createSparseSet(updater->capacity);
+  doneSet   = createSparseSet(updater->capacity);
+  region    = createVector(0);
+  for(slot = bitSetNext(updater->staleSet, 0); slot >= 0; slot = bitSetNext(updater->staleSet, slot + 1)){
+    if(slot >= updater->node->length)
+      continue;
+    nodePtr = updater->node->item[slot];
+    destroyVector(nodePtr->domFrontiers);
+    nodePtr->domFrontiers = NULL;
+    if(updater->level[slot] == NOT_REACHED)
+      continue;
+    nodePtr->domFrontiers = createVector(0);
+    addStaleRegion(updater, nodePtr, regionSet, region);
+  }
+
+  for(k = 0; k < region->length; k++){
+    nodePtr = region->item[k];
+    for(i = 0; i < nodePtr->numOfChild; i++){
+      joinNode = nodePtr->children[i];
+      if(slotSetHas(updater, doneSet, joinNode))
+        continue;
+      slotSetAdd(updater, doneSet, joinNode);
+
+      for(j = 0; j < joinNode->numOfDirectDom; j++){
+        runner = joinNode->directDom[j];
+        while(runner != NULL && runner != joinNode->imdDom && slotSetHas(updater, regionSet, runner)){
+          if(bitSetHas(updater->staleSet, runner->nodeIndex[INDEX_UPDATER]) && \
+             (runner->domFrontiers->length == 0 || VECTOR_LAST(runner->domFrontiers) != joinNode))
+            vectorAddLast(runner->domFrontiers, joinNode);
+          runner = runner->imdDom;
+        }
+      }
+    }
+  }
+
+  destroySparseSet(regionSet);
+  destroySparseSet(doneSet);
+  destroyVector(region);
+  bitSetClear(updater->staleSet);
+}
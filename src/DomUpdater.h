@@ -0,0 +1,74 @@
+#ifndef DomUpdater_H
+#define DomUpdater_H
+
+#include "ErrorObject.h"
+#include "BitSet.h"
+#include "NodeChain.h"
+
+#define NOT_REACHED  -1
+
+/**
+ * DomUpdater
+ *
+ *  Object of DomUpdater's type keep the imdDom of a CFG right while its
+ *  edges are added and removed, so a pass editing the CFG does not have
+ *  to set every dominator again. It follow the dynamic dominator of
+ *  Georgiadis et al. as LLVM's DomTreeUpdater does:
+ *
+ *    1. add x -> y, both reached   only the nodes reached from y through
+ *                                  nodes deeper than the nearest common
+ *                                  dominator (nca) of x and y can change,
+ *                                  they are found by a depth based search
+ *                                  and get nca as imdDom
+ *    2. add x -> y, y not reached  the part of the CFG y make reachable
+ *                                  get its dominators on its own, its
+ *                                  edges to the old part are then added
+ *                                  as in 1
+ *    3. remove x -> y              nothing change when y dominate x,
+ *                                  otherwise only the dominator subtree
+ *                                  of the nca of x and y is done again,
+ *                                  when part of it is no longer reached
+ *                                  the subtree of the nca of it and the
+ *                                  successors of that part is done again
+ *
+ *  Every node reached once get a slot, numbered with INDEX_UPDATER, so
+ *  the arrays hold the nodes of this CFG only.
+ *
+ *  DomUpdater contain:
+ *    1. root         the entry of the CFG
+ *    2. capacity     number of slot the arrays below can hold, they grow
+ *                    when a node is reached for the first time
+ *    3. node         node->item[s] is the node given slot s
+ *    4. level        level[s] is the depth of the node in the dominator
+ *                    tree, 0 for the root, NOT_REACHED when the node
+ *                    cannot be reached from the root
+ *    5. domChild     domChild[s] are the nodes whose imdDom is the node
+ *                    of slot s, NULL when there is none
+ *    6. staleSet     the slot of every node whose domFrontiers may have
+ *                    changed since the last refreshDomFrontiers
+ *
+ *  Change the edges only through domUpdaterAddChild/domUpdaterRemoveChild
+ *  while a DomUpdater is used, after any other change (splitNode,
+ *  splitCriticalEdges, addChild) create it again.
+ */
+typedef struct{
+  Node* root;
+  int capacity;
+  Vector* node;
+  int* level;
+  Vector** domChild;
+  BitSet* staleSet;
+}DomUpdater;
+
+DomUpdater* createDomUpdater(Node** rootNode);
+void destroyDomUpdater(DomUpdater* updater);
+
+void domUpdaterAddChild(DomUpdater* updater, Node** parentNode, Node** childNode);
+void domUpdaterRemoveChild(DomUpdater* updater, Node** parentNode, Node** childNode);
+
+int getDomLevel(DomUpdater* updater, Node* node);
+int isDomFrontierStale(DomUpdater* updater, Node* node);
+void markDomFrontierStale(DomUpdater* updater, Node* node);
+void refreshDomFrontiers(DomUpdater* updater);
+
+#endif // DomUpdater_H
@@ -0,0 +1,220 @@
+#include "Dominator.h"
+#include "Allocator.h"
+#include <stdlib.h>
+
+#define NOT_PROCESSED   -1
+
+/*
+ *  intersect
+ *  Walk both finger up the dominator tree until they meet. A node with a
+ *  bigger reverse postorder number can never dominate a smaller one, so
+ *  the bigger finger is always the one to move.
+ */
+static int intersect(int* imdDom, int finger_1, int finger_2){
+  while(finger_1 != finger_2){
+    while(finger_1 > finger_2)
+      finger_1 = imdDom[finger_1];
+    while(finger_2 > finger_1)
+      finger_2 = imdDom[finger_2];
+  }
+  return finger_1;
+}
+
+/**
+ *  setAllImdDomIterative
+ *  Every reachable node get its imdDom, the root get NULL. Only the
+ *  directDom that can be reached from the root are taken into account.
+ */
+void setAllImdDomIterative(Node** rootNode){
+  if(rootNode == NULL || *rootNode == NULL)
+    ThrowError(ERR_NULL_NODE, "Empty Tree input detected!");
+
+  Vector* order       = getNodeOrder(*rootNode, ORDER_RPO);
+  int* imdDom         = memAlloc(MEM_LIST, sizeof(int) * order->length);
+  Node* nodePtr;
+  int b, i, pred, newImdDom, changed;
+
+  /*  the number of a node in order is its reverse postorder number */
+  numberNodes(order, INDEX_ORDER);
+  for(b = 0; b < order->length; b++)
+    imdDom[b] = NOT_PROCESSED;
+  imdDom[0] = 0;
+
+  do{
+    changed = 0;
+    for(b = 1; b < order->length; b++){
+      nodePtr   = order->item[b];
+      newImdDom = NOT_PROCESSED;
+      for(i = 0; i < nodePtr->numOfDirectDom; i++){
+        pred = getNodeIndex(order, nodePtr->directDom[i], INDEX_ORDER);
+        if(pred == NOT_NUMBERED || imdDom[pred] == NOT_PROCESSED)
+          continue;
+
+        if(newImdDom == NOT_PROCESSED)
+          newImdDom = pred;
+        else
+          newImdDom = intersect(imdDom, pred, newImdDom);
+      }
+
+      if(imdDom[b] != newImdDom){
+        imdDom[b] = newImdDom;
+        changed   = 1;
+      }
+    }
+  }while(changed);
+
+  ((Node*)order->item[0])->imdDom = NULL;
+  for(b = 1; b < order->length; b++)
+    ((Node*)order->item[b])->imdDom = imdDom[b] == NOT_PROCESSED ? NULL : order->item[imdDom[b]];
+
+  memFree(MEM_LIST, imdDom, sizeof(int) * order->length);
+}
+
+/*
+ *  dfsPreorder
+ *  Number every node reachable from (rootNode) in depth first preorder.
+ *  (vertex) get the nodes numbered with INDEX_ORDER, vertex[v] is the
+ *  node numbered v and dfsParent[v] the number of the node v was reached
+ *  from. The array need space for the (numOfNode) reachable node.
+ *
+ *  return the number of node
+ */
+static int dfsPreorder(Node* rootNode, Vector* vertex, int* dfsParent, int numOfNode){
+  int* stack    = memAlloc(MEM_LIST, sizeof(int) * numOfNode);
+  int* nextOf   = memAlloc(MEM_LIST, sizeof(int) * numOfNode);
+  Node *nodePtr, *childPtr;
+  int v, n = 0, top = 0;
+
+  addNumberedNode(vertex, rootNode, INDEX_ORDER);
+  dfsParent[n]  = NOT_PROCESSED;
+  nextOf[n]     = 0;
+  stack[top++]  = n++;
+
+  while(top > 0){
+    v       = stack[top - 1];
+    nodePtr = vertex->item[v];
+    if(nextOf[v] == nodePtr->numOfChild){
+      top--;
+      continue;
+    }
+
+    childPtr = nodePtr->children[nextOf[v]++];
+    if(getNodeIndex(vertex, childPtr, INDEX_ORDER) == NOT_NUMBERED){
+      addNumberedNode(vertex, childPtr, INDEX_ORDER);
+      dfsParent[n]  = v;
+      nextOf[n]     = 0;
+      stack[top++]  = n++;
+    }
+  }
+
+  memFree(MEM_LIST, stack, sizeof(int) * numOfNode);
+  memFree(MEM_LIST, nextOf, sizeof(int) * numOfNode);
+  return n;
+}
+
+/*
+ *  eval
+ *  Return the node with the smallest semidominator on the forest path
+ *  from (v) up to its root, compressing the path on the way. The path is
+ *  kept in (pathStack) instead of recursing.
+ */
+static int eval(int v, int* ancestor, int* label, int* semi, int* pathStack){
+  int u, a, top = 0;
+
+  if(ancestor[v] == NOT_PROCESSED)
+    return v;
+
+  for(u = v; ancestor[ancestor[u]] != NOT_PROCESSED; u = ancestor[u])
+    pathStack[top++] = u;
+
+  while(top > 0){
+    u = pathStack[--top];
+    a = ancestor[u];
+    if(semi[label[a]] < semi[label[u]])
+      label[u] = label[a];
+    ancestor[u] = ancestor[a];
+  }
+  return label[v];
+}
+
+/**
+ *  setAllImdDomSemiNCA
+ *  Every reachable node get its imdDom, the root get NULL. Only the
+ *  directDom that can be reached from the root are taken into account.
+ */
+void setAllImdDomSemiNCA(Node** rootNode){
+  if(rootNode == NULL || *rootNode == NULL)
+    ThrowError(ERR_NULL_NODE, "Empty Tree input detected!");
+
+  int numOfNode       = getNodeOrder(*rootNode, ORDER_RPO)->length;
+  Vector* vertex      = createVector(numOfNode);
+  int* imdDom         = memAlloc(MEM_LIST, sizeof(int) * numOfNode);
+  int n               = dfsPreorder(*rootNode, vertex, imdDom, numOfNode);
+  int* semi           = memAlloc(MEM_LIST, sizeof(int) * n);
+  int* label          = memAlloc(MEM_LIST, sizeof(int) * n);
+  int* ancestor       = memAlloc(MEM_LIST, sizeof(int) * n);
+  int* pathStack      = memAlloc(MEM_LIST, sizeof(int) * n);
+  Node* nodePtr;
+  int w, i, u;
+
+  /*  imdDom start as the DFS parent given by dfsPreorder */
+  for(w = 0; w < n; w++){
+    semi[w]     = w;
+    label[w]    = w;
+    ancestor[w] = NOT_PROCESSED;
+  }
+
+  /*  semidominator, from the last preorder number back to the first */
+  for(w = n - 1; w > 0; w--){
+    nodePtr = vertex->item[w];
+    for(i = 0; i < nodePtr->numOfDirectDom; i++){
+      u = getNodeIndex(vertex, nodePtr->directDom[i], INDEX_ORDER);
+      if(u == NOT_NUMBERED)
+        continue;
+
+      u = eval(u, ancestor, label, semi, pathStack);
+      if(semi[u] < semi[w])
+        semi[w] = semi[u];
+    }
+    ancestor[w] = imdDom[w];
+  }
+
+  /*  imdDom is the nearest common ancestor of the DFS parent and semi */
+  for(w = 1; w < n; w++)
+    while(imdDom[w] > semi[w])
+      imdDom[w] = imdDom[imdDom[w]];
+
+  (*rootNode)->imdDom = NULL;
+  for(w = 1; w < n; w++)
+    ((Node*)vertex->item[w])->imdDom = vertex->item[imdDom[w]];
+
+  memFree(MEM_LIST, semi, sizeof(int) * n);
+  memFree(MEM_LIST, label, sizeof(int) * n);
+  memFree(MEM_LIST, ancestor, sizeof(int) * n);
+  memFree(MEM_LIST, pathStack, sizeof(int) * n);
+  memFree(MEM_LIST, imdDom, sizeof(int) * numOfNode);
+  destroyVector(vertex);
+}
+
+/**
+ *  setAllImdDomWith
+ *  Set the imdDom of every node with the chosen algorithm.
+ *  DOM_LAST_BRANCH is the setLastBrhDom + setAllImdDom path, which rely
+ *  on the rank of the node.
+ */
+void setAllImdDomWith(Node** rootNode, DomAlgorithm algorithm){
+  switch(algorithm){
+    case DOM_LAST_BRANCH:
+      setLastBrhDom(rootNode);
+      setAllImdDom(rootNode);
+      break;
+    case DOM_ITERATIVE:
+      setAllImdDomIterative(rootNode);
+      break;
+    case DOM_SEMI_NCA:
+      setAllImdDomSemiNCA(rootNode);
+      break;
+    default:
+      ThrowError(ERR_UNHANDLE_ERROR, "Unknown dominator algorithm %d", algorithm);
+  }
+}
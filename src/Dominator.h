@@ -0,0 +1,39 @@
+#ifndef Dominator_H
+#define Dominator_H
+
+#include "ErrorObject.h"
+#include "NodeChain.h"
+
+/**
+ * Dominator
+ *
+ *  setAllImdDomIterative set the imdDom of every node reachable from the
+ *  root with the iterative algorithm of Cooper, Harvey and Kennedy ("A
+ *  Simple, Fast Dominance Algorithm"). The nodes are numbered in reverse
+ *  postorder, then the imdDom of every node is set to the common
+ *  dominator ("intersect") of its processed directDom until nothing
+ *  change. A CFG without loop is done in one round.
+ *
+ *  setAllImdDomSemiNCA give the same imdDom with the Semi-NCA algorithm
+ *  of Georgiadis, Tarjan and Werneck: the semidominator of Lengauer-Tarjan
+ *  is found with a path compressed forest, then the imdDom is the nearest
+ *  common ancestor of the DFS parent and the semidominator. It never go
+ *  over the graph more than once, so it is the one to use on a CFG of
+ *  many thousand node. Both the DFS and the path compression use their
+ *  own stack.
+ *
+ *  Unlike setLastBrhDom/setAllImdDom both only follow the edges, so the
+ *  rank given to the node do not have to follow the dominance.
+ *  setAllImdDomWith pick one of the three by DomAlgorithm.
+ */
+typedef enum{
+  DOM_LAST_BRANCH,
+  DOM_ITERATIVE,
+  DOM_SEMI_NCA
+}DomAlgorithm;
+
+void setAllImdDomIterative(Node** rootNode);
+void setAllImdDomSemiNCA(Node** rootNode);
+void setAllImdDomWith(Node** rootNode, DomAlgorithm algorithm);
+
+#endif // Dominator_H
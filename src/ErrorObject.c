@@ -1,7 +1,9 @@
-#include <malloc.h>
 #include "ErrorObject.h"
+#include "Allocator.h"
 #include "CException.h"
 #include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
 
 /**
  *  ThrowError generate a errorObj that stored the detail of errObj 
@@ -19,14 +21,16 @@
  *        [   ERR_UNDEFINED_OPERATOR    ]
  */
 void ThrowError(ErrorCode errCode, char *message, ...){
-  ErrorObject* errObj = malloc(sizeof(ErrorObject));
+  ErrorObject* errObj = memAlloc(MEM_ERROR, sizeof(ErrorObject));
   char *messageBuffer;
   int strLength;
 
-  va_list args;
+  va_list args, argsCopy;
   va_start(args, message);
-  strLength     = vsnprintf(messageBuffer, 0, message, args);
-  messageBuffer = malloc(strLength + 1);
+  va_copy(argsCopy, args);
+  strLength     = vsnprintf(NULL, 0, message, argsCopy);
+  va_end(argsCopy);
+  messageBuffer = memAlloc(MEM_ERROR, strLength + 1);
   vsprintf(messageBuffer, message, args);
 
   errObj->errorMsg  = messageBuffer;
@@ -37,5 +41,9 @@ void ThrowError(ErrorCode errCode, char *message, ...){
 }
 
 void freeError(ErrorObject *errObj){
-  free(errObj);
+  if(errObj == NULL)
+    return;
+
+  memFree(MEM_ERROR, errObj->errorMsg, strlen(errObj->errorMsg) + 1);
+  memFree(MEM_ERROR, errObj, sizeof(ErrorObject));
 }
@@ -9,6 +9,8 @@ typedef enum{
   ERR_NULL_SUBSCRIPT,
   ERR_UNDECLARE_VARIABLE,
   ERR_INVALID_BRANCH,
+  ERR_INDEX_OUT_OF_RANGE,
+  ERR_NO_EDGE,
   ERR_UNHANDLE_ERROR
 } ErrorCode;
 
@@ -1,11 +1,14 @@
 #include "ExpressionBlock.h"
+#include "Allocator.h"
+#include "VersionMap.h"
+#include "VersionTree.h"
 #include <stdlib.h>
 #include <stdio.h>
 
 
 Expression* createExpression(int thisID, Operator oprt, int oprdA,\
                             int oprdB, int condt){
-  Expression* newExp = malloc(sizeof(Expression));
+  Expression* newExp = memAlloc(MEM_EXPRESSION, sizeof(Expression));
   
   newExp->id.name     = thisID;
   newExp->id.index    = 0;
@@ -16,10 +19,18 @@ Expression* createExpression(int thisID, Operator oprt, int oprdA,\
   newExp->oprdB.index = 0;
   newExp->condt.name  = condt;
   newExp->condt.index = 0;
+  newExp->phiOprd     = NULL;
+  newExp->numOfPhiOprd = 0;
 
   return newExp;            
 }
 
+void freeExpression(Expression* expression){
+  if(expression->phiOprd != NULL)
+    memFree(MEM_EXPRESSION, expression->phiOprd, sizeof(Subscript) * expression->numOfPhiOprd);
+  memFree(MEM_EXPRESSION, expression, sizeof(Expression));
+}
+
 
 /*
  *  arrangeSSA take in the inputNode and arrange all the expression
@@ -36,9 +47,9 @@ void arrangeSSA(Node* inputNode){
     ThrowError(ERR_NULL_NODE, "NULL input detected in arrangeSSA");
   
   LinkedList* exprList  = inputNode->block;
-  LinkedList* checkList = getSubsList(inputNode->block);
+  Vector* checkList     = getSubsList(inputNode->block);
   ListElement* exprPtr  = exprList->head;
-  ListElement* checkPtr;
+  int checkIdx;
   
   int currentRank, oprARank, oprBRank;
   
@@ -48,21 +59,22 @@ void arrangeSSA(Node* inputNode){
     oprBRank = ((Expression*)exprPtr->node)->oprdB.index;
     
     if(((Expression*)exprPtr->node)->opr != IF_STATEMENT){
-      checkPtr = checkList->head;
-      CHANGE_ID_SUBSCRIPT(exprPtr, checkPtr, currentRank);  
+      checkIdx = 0;
+      CHANGE_ID_SUBSCRIPT(exprPtr, checkList, checkIdx, currentRank);  
                 
       if(((Expression*)exprPtr->node)->opr != ASSIGN){
-        checkPtr = checkList->head;
-        CHANGE_OPERAND_A(exprPtr, checkPtr, oprARank);
+        checkIdx = 0;
+        CHANGE_OPERAND_A(exprPtr, checkList, checkIdx, oprARank);
                 
         if(((Expression*)exprPtr->node)->opr != COPY){
-          checkPtr = checkList->head;
-          CHANGE_OPERAND_B(exprPtr, checkPtr, oprBRank);
+          checkIdx = 0;
+          CHANGE_OPERAND_B(exprPtr, checkList, checkIdx, oprBRank);
         }
       }
     }
     exprPtr = exprPtr->next;
   }
+  destroyVector(checkList);
 }
 
 
@@ -73,23 +85,68 @@ void arrangeSSA(Node* inputNode){
  *  to a higher index when the same subscript was found in
  *  another group.
  *
+ *  @updtList   the largest index ever given to each variable, shared
+ *              by the whole traversal
+ *  @prevList   the latest subscript of each variable at the entry of
+ *              inputNode, NULL for the root. Every child get its own
+ *              version of it from getLatestTree
+ *
+ **********************************************************/
+static void visitAllNodeSSA(Node* inputNode, VersionMap* updtList, VersionTree* prevList){
+  VersionTree* curList = assignNodeSSA(inputNode, updtList, prevList);
+  int i;
+
+  for(i=0; i < inputNode->numOfChild; i++){
+    if(!isVisited(inputNode->children[i], VISIT_SSA))
+      visitAllNodeSSA(inputNode->children[i], updtList, curList);
+  }
+  destroyVersionTree(curList);
+}
+
+void assignAllNodeSSA(Node* inputNode, VersionMap* updtList, VersionTree* prevList){
+  setAllImdDom(&inputNode);
+  startVisit(VISIT_SSA);
+  visitAllNodeSSA(inputNode, updtList, prevList);
+}
+
+/*  assignNodeSSA
+ *
+ *  The work assignAllNodeSSA does on a single node, without going down
+ *  to the children. The imdDom must already be set, assignAllNodeSSA
+ *  set all of them in one pass before the first node.
+ *
+ *  return the latest subscript of each variable at the exit of inputNode,
+ *  give it back with destroyVersionTree
+ *
  **********************************************************/
-void assignAllNodeSSA(Node* inputNode, LinkedList* updtList, LinkedList* prevList){
-  inputNode->visitFlag  |= 1;
-  getImdDom(inputNode);
+VersionTree* assignNodeSSA(Node* inputNode, VersionMap* updtList, VersionTree* prevList){
+  markVisited(inputNode, VISIT_SSA);
   arrangeSSA(inputNode);
   LinkedList* liveList  = getAllLiveList(&inputNode, createLinkedList());
+
+  return renameNodeSSA(inputNode, liveList, updtList, prevList);
+}
+
+/*  renameNodeSSA
+ *
+ *  Second half of assignNodeSSA, once the imdDom of inputNode is set
+ *  and its subscript arranged. (liveList) is the live subscript found
+ *  from inputNode, it is destroyed here. frozenAssignAllNodeSSA find
+ *  the imdDom and liveList on the frozen view and call it directly.
+ *
+ **********************************************************/
+VersionTree* renameNodeSSA(Node* inputNode, LinkedList* liveList, VersionMap* updtList, VersionTree* prevList){
   LinkedList* lhsList   = getModifiedList(inputNode);
   if(inputNode->rank == 0){
+    destroyLinkedList(liveList);
+    destroyLinkedList(lhsList);
     liveList  = createLinkedList();
     lhsList  = createLinkedList();
   }
-  ListElement* updtPtr  = updtList->head;
-  ListElement* prevPtr  = prevList->head;
   ListElement* livePtr  = liveList->head;
+  Subscript *prevSubs, *updtSubs;
   
-  int subsName, i;
-  Expression* newExpr;
+  int subsName;
   
   /********************************************************
    *  Handle rhs with prevList
@@ -97,15 +154,11 @@ void assignAllNodeSSA(Node* inputNode, LinkedList* updtList, LinkedList* prevLis
   while(livePtr != NULL){
     subsName  = ((Subscript*)livePtr->node)->name;
     
-    prevPtr = prevList->head;
-    while(((Subscript*)prevPtr->node)->name != subsName){
-      if(prevPtr->next != NULL)
-        prevPtr = prevPtr->next;
-      else
-        ThrowError(ERR_UNDECLARE_VARIABLE, "Subscript %c not define yet!", subsName);
-    }
+    prevSubs  = versionTreeFind(prevList, subsName);
+    if(prevSubs == NULL)
+      ThrowError(ERR_UNDECLARE_VARIABLE, "Subscript %c not define yet!", subsName);
     
-    ((Subscript*)livePtr->node)->index = ((Subscript*)prevPtr->node)->index;
+    ((Subscript*)livePtr->node)->index = prevSubs->index;
     if(inputNode->parent != inputNode->imdDom)
       ((Subscript*)livePtr->node)->index++;
     
@@ -118,12 +171,9 @@ void assignAllNodeSSA(Node* inputNode, LinkedList* updtList, LinkedList* prevLis
   while(livePtr != NULL){
     subsName  = ((Subscript*)livePtr->node)->name;
     
-    updtPtr  = updtList->head;
-    while(updtPtr != NULL && ((Subscript*)updtPtr->node)->name != subsName){
-        updtPtr = updtPtr->next;
-    }
-    if(updtPtr != NULL)
-      ((Subscript*)livePtr->node)->index = ((Subscript*)updtPtr->node)->index + 1;
+    updtSubs  = versionMapFind(updtList, subsName);
+    if(updtSubs != NULL)
+      ((Subscript*)livePtr->node)->index = updtSubs->index + 1;
     
     if(inputNode->parent != inputNode->imdDom){
       ((Subscript*)livePtr->node)->index++;
@@ -132,14 +182,12 @@ void assignAllNodeSSA(Node* inputNode, LinkedList* updtList, LinkedList* prevLis
     livePtr = livePtr->next;
   }
   
+  destroyLinkedList(liveList);
+  destroyLinkedList(lhsList);
+  
   arrangeSSA(inputNode);
   updateList(inputNode, updtList);
-  LinkedList* curList = getLatestList(inputNode, prevList);
-
-  for(i=0; i < inputNode->numOfChild; i++){
-    if((inputNode->children[i]->visitFlag & 1) == 0)
-      assignAllNodeSSA(inputNode->children[i], updtList, curList);
-  }
+  return getLatestTree(inputNode, prevList);
 }
 
 
@@ -2,45 +2,53 @@
 #define ExpressionBlock_H
 
 #include "LinkedList.h"
+#include "Vector.h"
 #include "ErrorObject.h"
 typedef struct Expression_t Expression;
 typedef struct Subscript_t Subscript;
+typedef struct VersionMap_t VersionMap;
+typedef struct VersionTree_t VersionTree;
 #include "GetList.h"
 #include "NodeChain.h"
 
-#define CHANGE_ID_SUBSCRIPT(exprPtr, checkPtr, currentRank)                   \
-                while(&(((Expression*)exprPtr->node)->id) != checkPtr->node){ \
+#define CHANGE_ID_SUBSCRIPT(exprPtr, checkList, checkIdx, currentRank)            \
+                while(&(((Expression*)exprPtr->node)->id) !=                  \
+                      checkList->item[checkIdx]){                             \
                                                                               \
                   if(((Expression*)exprPtr->node)->id.name ==                 \
-                      ((Subscript*)checkPtr->node)->name &&                   \
-                    currentRank <= ((Subscript*)checkPtr->node)->index){      \
-                    currentRank = ((Subscript*)checkPtr->node)->index + 1;    \
+                      ((Subscript*)checkList->item[checkIdx])->name &&        \
+                    currentRank <=                                            \
+                      ((Subscript*)checkList->item[checkIdx])->index){        \
+                    currentRank =                                             \
+                      ((Subscript*)checkList->item[checkIdx])->index + 1;     \
                   }                                                           \
-                  checkPtr = checkPtr->next;                                  \
+                  checkIdx++;                                                 \
                 }                                                             \
                 ((Expression*)exprPtr->node)->id.index = currentRank;
 
                 
-#define CHANGE_OPERAND_A(exprPtr, checkPtr, oprARank)                           \
-                while(&((Expression*)exprPtr->node)->oprdA != checkPtr->node){  \
+#define CHANGE_OPERAND_A(exprPtr, checkList, checkIdx, oprARank)                \
+                while(&((Expression*)exprPtr->node)->oprdA !=                   \
+                      checkList->item[checkIdx]){                               \
                   if(((Expression*)exprPtr->node)->oprdA.name ==                \
-                    ((Subscript*)checkPtr->node)->name &&                       \
-                    oprARank < ((Subscript*)checkPtr->node)->index){            \
-                    oprARank = ((Subscript*)checkPtr->node)->index;             \
+                    ((Subscript*)checkList->item[checkIdx])->name &&            \
+                    oprARank < ((Subscript*)checkList->item[checkIdx])->index){ \
+                    oprARank = ((Subscript*)checkList->item[checkIdx])->index;  \
                   }                                                             \
-                  checkPtr = checkPtr->next;                                    \
+                  checkIdx++;                                                   \
                 }                                                               \
                 ((Expression*)exprPtr->node)->oprdA.index = oprARank;
 
                 
-#define CHANGE_OPERAND_B(exprPtr, checkPtr, oprBRank)                           \
-                while(&((Expression*)exprPtr->node)->oprdB != checkPtr->node){  \
+#define CHANGE_OPERAND_B(exprPtr, checkList, checkIdx, oprBRank)                \
+                while(&((Expression*)exprPtr->node)->oprdB !=                   \
+                      checkList->item[checkIdx]){                               \
                   if(((Expression*)exprPtr->node)->oprdB.name ==                \
-                    ((Subscript*)checkPtr->node)->name &&                       \
-                    oprBRank < ((Subscript*)checkPtr->node)->index){            \
-                    oprBRank = ((Subscript*)checkPtr->node)->index;             \
+                    ((Subscript*)checkList->item[checkIdx])->name &&            \
+                    oprBRank < ((Subscript*)checkList->item[checkIdx])->index){ \
+                    oprBRank = ((Subscript*)checkList->item[checkIdx])->index;  \
                   }                                                             \
-                  checkPtr = checkPtr->next;                                    \
+                  checkIdx++;                                                   \
                 }                                                               \
                 ((Expression*)exprPtr->node)->oprdB.index = oprBRank;
                 
@@ -66,19 +74,30 @@ struct Subscript_t{
   int index;
 };
 
+/**
+ *  A PHI_FUNC keep one operand per predecessor of its node in phiOprd,
+ *  phiOprd[i] is the Subscript reaching from directDom[i]. oprdB and
+ *  oprdA repeat phiOprd[0] and phiOprd[1]. Every other operator leave
+ *  phiOprd NULL and numOfPhiOprd 0.
+ */
 struct Expression_t{
   Subscript id;
   Operator opr;
   Subscript oprdA;
   Subscript oprdB;
   Subscript condt;
+  Subscript* phiOprd;
+  int numOfPhiOprd;
 };
 
 
 Expression* createExpression(int thisID, Operator oprt,        \
                             int oprdA, int oprdB, int condt);
+void freeExpression(Expression* expression);
 
 void arrangeSSA(Node* inputNode);
-void assignAllNodeSSA(Node* inputNode, LinkedList* liveList, LinkedList* prevList);
+void assignAllNodeSSA(Node* inputNode, VersionMap* updtList, VersionTree* prevList);
+VersionTree* assignNodeSSA(Node* inputNode, VersionMap* updtList, VersionTree* prevList);
+VersionTree* renameNodeSSA(Node* inputNode, LinkedList* liveList, VersionMap* updtList, VersionTree* prevList);
 
 #endif // ExpressionBlock_H
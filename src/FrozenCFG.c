@@ -0,0 +1,696 @@
+#include "FrozenCFG.h"
+#include "Allocator.h"
+#include "BitSet.h"
+#include "LcaIndex.h"
+#include "PhiFunction.h"
+#include "VersionTree.h"
+#include "VersionMap.h"
+#include "GetList.h"
+#include <stdlib.h>
+
+#define NUM_OF_SUCC(cfg, block)   ((cfg)->succStart[(block) + 1] - (cfg)->succStart[(block)])
+
+/*
+ *  Same as FIND_SAME_NODE of NodeChain.h, on block id
+ */
+#define FIND_SAME_BLOCK(cfg, block_1, block_2)                    \
+          while(block_1 != block_2 &&                             \
+                block_1 != NO_BLOCK && block_2 != NO_BLOCK){      \
+            if((cfg)->rank[block_1] < (cfg)->rank[block_2])      \
+              block_2 = (cfg)->lastBrhDom[block_2];               \
+            else                                                  \
+              block_1 = (cfg)->lastBrhDom[block_1];               \
+          }
+
+/*
+ *  FrozenPair
+ *  FrontierPair of NodeChain.c on block id, (frontier) belong to the
+ *  domFrontiers of (block)
+ */
+typedef struct{
+  int block;
+  int frontier;
+  int next;
+}FrozenPair;
+
+/*
+ *  The arrays hold one more int than asked, so a CFG without any edge
+ *  still get a real pointer
+ */
+static int* createBlockArray(int length){
+  return memAlloc(MEM_NODE, sizeof(int) * (length + 1));
+}
+
+static void destroyBlockArray(int* array, int length){
+  memFree(MEM_NODE, array, sizeof(int) * (length + 1));
+}
+
+static int blockOf(Vector* nodeList, Node* node){
+  if(node == NULL)
+    return NO_BLOCK;
+
+  return getNodeIndex(nodeList, node, INDEX_ORDER);
+}
+
+static Node* nodeOf(FrozenCFG* cfg, int block){
+  return block == NO_BLOCK ? NULL : cfg->node[block];
+}
+
+/**
+ *  freezeCFG
+ *  Pack every Node reachable from (rootNode) into a FrozenCFG.
+ *
+ *  The Node are numbered in the order they are found by a breadth first
+ *  walk, the number of a Node inside (nodeList) is its block id.
+ */
+FrozenCFG* freezeCFG(Node** rootNode){
+  if(rootNode == NULL || *rootNode == NULL)
+    ThrowError(ERR_NULL_NODE, "Empty Tree input detected!");
+
+  FrozenCFG* cfg      = memAlloc(MEM_NODE, sizeof(FrozenCFG));
+  Vector* nodeList    = createVector(0);
+  Node* nodePtr;
+  int b, i, k, numOfEdge = 0;
+
+  addNumberedNode(nodeList, *rootNode, INDEX_ORDER);
+  for(b = 0; b < nodeList->length; b++){
+    nodePtr    = nodeList->item[b];
+    numOfEdge += nodePtr->numOfChild;
+    for(i = 0; i < nodePtr->numOfChild; i++)
+      addNumberedNode(nodeList, nodePtr->children[i], INDEX_ORDER);
+  }
+
+  cfg->numOfBlock = nodeList->length;
+  cfg->numOfEdge  = numOfEdge;
+  cfg->node       = memAlloc(MEM_NODE, sizeof(Node*) * cfg->numOfBlock);
+  cfg->succStart  = createBlockArray(cfg->numOfBlock);
+  cfg->succ       = createBlockArray(numOfEdge);
+  cfg->predStart  = createBlockArray(cfg->numOfBlock);
+  cfg->pred       = createBlockArray(numOfEdge);
+  cfg->rank       = createBlockArray(cfg->numOfBlock);
+  cfg->parent     = createBlockArray(cfg->numOfBlock);
+  cfg->lastBrhDom = createBlockArray(cfg->numOfBlock);
+  cfg->imdDom     = createBlockArray(cfg->numOfBlock);
+
+  /* successor and the attribute of every block */
+  k = 0;
+  for(b = 0; b < cfg->numOfBlock; b++){
+    nodePtr             = nodeList->item[b];
+    cfg->node[b]        = nodePtr;
+    cfg->succStart[b]   = k;
+    for(i = 0; i < nodePtr->numOfChild; i++)
+      cfg->succ[k++]    = blockOf(nodeList, nodePtr->children[i]);
+
+    cfg->rank[b]        = nodePtr->rank;
+    cfg->parent[b]      = blockOf(nodeList, nodePtr->parent);
+    cfg->lastBrhDom[b]  = blockOf(nodeList, nodePtr->lastBrhDom);
+    cfg->imdDom[b]      = blockOf(nodeList, nodePtr->imdDom);
+  }
+  cfg->succStart[cfg->numOfBlock] = k;
+
+  /* predecessor, in the order of directDom, a predecessor that cannot be
+     reached from the root is left out */
+  k = 0;
+  for(b = 0; b < cfg->numOfBlock; b++){
+    nodePtr           = cfg->node[b];
+    cfg->predStart[b] = k;
+    for(i = 0; i < nodePtr->numOfDirectDom; i++)
+      if(blockOf(nodeList, nodePtr->directDom[i]) != NO_BLOCK)
+        cfg->pred[k++] = blockOf(nodeList, nodePtr->directDom[i]);
+  }
+  cfg->predStart[cfg->numOfBlock] = k;
+
+  destroyVector(nodeList);
+  return cfg;
+}
+
+void destroyFrozenCFG(FrozenCFG* cfg){
+  if(cfg == NULL)
+    return;
+
+  memFree(MEM_NODE, cfg->node, sizeof(Node*) * cfg->numOfBlock);
+  destroyBlockArray(cfg->succStart, cfg->numOfBlock);
+  destroyBlockArray(cfg->succ, cfg->numOfEdge);
+  destroyBlockArray(cfg->predStart, cfg->numOfBlock);
+  destroyBlockArray(cfg->pred, cfg->numOfEdge);
+  destroyBlockArray(cfg->rank, cfg->numOfBlock);
+  destroyBlockArray(cfg->parent, cfg->numOfBlock);
+  destroyBlockArray(cfg->lastBrhDom, cfg->numOfBlock);
+  destroyBlockArray(cfg->imdDom, cfg->numOfBlock);
+  memFree(MEM_NODE, cfg, sizeof(FrozenCFG));
+}
+
+/*
+ *  frozenAssembleList
+ *  Same walk as assembleList, starting from (rootBlock). A block reached
+ *  from more than one pred can be put in more than once and walked again,
+ *  so the list grow like the Vector of assembleList does. (capacity) start
+ *  as the size of (*blockList) and is updated when the list grow, the
+ *  caller free the list with destroyBlockArray(*blockList, *capacity).
+ *
+ *  return the number of block put into (*blockList)
+ */
+static int frozenAssembleList(FrozenCFG* cfg, int rootBlock, int** blockList, int* capacity){
+  int i, k, b, s, length = 0;
+  int* list = *blockList;
+
+  list[length++] = rootBlock;
+  for(k = 0; k < length; k++){
+    b = list[k];
+    for(i = cfg->succStart[b]; i < cfg->succStart[b + 1]; i++){
+      s = cfg->succ[i];
+      if(list[length - 1] == s || cfg->rank[b] >= cfg->rank[s])
+        continue;
+      if(length > *capacity){
+        list = memRealloc(MEM_NODE, list, sizeof(int) * (*capacity + 1), \
+                          sizeof(int) * (*capacity * 2 + 2));
+        *capacity = *capacity * 2 + 1;
+      }
+      list[length++] = s;
+    }
+  }
+  *blockList = list;
+  return length;
+}
+
+/*
+ *  frozenPreorder
+ *  Depth first walk from (rootBlock) in the same order as the recursion
+ *  of allocPhiFunc/assignAllNodeSSA/getAllLiveList. A block is visited
+ *  once, visitMark[b] is set to (visit) when b is reached, a new value
+ *  of (visit) start a new walk over the same visitMark. The rootBlock is
+ *  always put first, like the recursion does on its input Node.
+ *
+ *  return the number of block put into (order), dfsParent[b] is the block
+ *  b was reached from
+ */
+static int frozenPreorder(FrozenCFG* cfg, int rootBlock, int* visitMark, int visit, \
+                          int* order, int* dfsParent){
+  int* stack    = createBlockArray(cfg->numOfBlock);
+  int* nextSucc = createBlockArray(cfg->numOfBlock);
+  int b, s, top = 0, length = 0;
+
+  visitMark[rootBlock]  = visit;
+  dfsParent[rootBlock]  = NO_BLOCK;
+  nextSucc[rootBlock]   = cfg->succStart[rootBlock];
+  order[length++]       = rootBlock;
+  stack[top++]          = rootBlock;
+
+  while(top > 0){
+    b = stack[top - 1];
+    if(nextSucc[b] == cfg->succStart[b + 1]){
+      top--;
+      continue;
+    }
+
+    s = cfg->succ[nextSucc[b]++];
+    if(visitMark[s] != visit){
+      visitMark[s]    = visit;
+      dfsParent[s]    = b;
+      nextSucc[s]     = cfg->succStart[s];
+      order[length++] = s;
+      stack[top++]    = s;
+    }
+  }
+
+  destroyBlockArray(stack, cfg->numOfBlock);
+  destroyBlockArray(nextSucc, cfg->numOfBlock);
+  return length;
+}
+
+/*
+ *  createVisitMark
+ *  A visitMark for frozenPreorder with no block visited yet
+ */
+static int* createVisitMark(FrozenCFG* cfg){
+  int* visitMark = createBlockArray(cfg->numOfBlock);
+  int b;
+
+  for(b = 0; b < cfg->numOfBlock; b++)
+    visitMark[b] = 0;
+  return visitMark;
+}
+
+/*
+ *  frozenAllLiveList
+ *  getAllLiveList on the frozen view, the block already marked with
+ *  (visit) are left out except (block) itself. (order) and (dfsParent)
+ *  are scratch of numOfBlock space.
+ *
+ *  return the live subscript of every block walked, one per name
+ */
+static LinkedList* frozenAllLiveList(FrozenCFG* cfg, int block, int* visitMark, int visit, \
+                                     int* order, int* dfsParent){
+  LinkedList* liveList  = createLinkedList();
+  VersionMap* liveMap   = createVersionMap(0);
+  LinkedList* thisLiveList;
+  ListElement* thisPtr;
+  int k, length         = frozenPreorder(cfg, block, visitMark, visit, order, dfsParent);
+
+  for(k = 0; k < length; k++){
+    thisLiveList = getLiveList(&cfg->node[order[k]]);
+    for(thisPtr = thisLiveList->head; thisPtr != NULL; thisPtr = thisPtr->next){
+      if(versionMapFind(liveMap, ((Subscript*)thisPtr->node)->name) == NULL){
+        addListLast(liveList, (Subscript*)thisPtr->node);
+        versionMapPut(liveMap, *(Subscript*)thisPtr->node, NULL);
+      }
+    }
+    destroyLinkedList(thisLiveList);
+  }
+
+  destroyVersionMap(liveMap);
+  return liveList;
+}
+
+/*
+ *  frozenPathToBlock
+ *  getPathToNode on the frozen view, the first path from (block) down
+ *  to (stopBlock) by rising rank is put into (path). The path is its own
+ *  stack, nextSucc[d] is the next successor to try from path[d], so a
+ *  deep CFG does not run out of C stack. Both need numOfBlock space.
+ *
+ *  return the length of the path, 0 when there is none
+ */
+static int frozenPathToBlock(FrozenCFG* cfg, int block, int stopBlock, int* path, int* nextSucc){
+  int b, s, depth = 0;
+
+  path[0]     = block;
+  nextSucc[0] = cfg->succStart[block];
+  while(depth >= 0){
+    b = path[depth];
+    if(cfg->rank[b] >= cfg->rank[stopBlock]){
+      if(b == stopBlock)
+        return depth + 1;
+      depth--;
+      continue;
+    }
+
+    s = NO_BLOCK;
+    while(nextSucc[depth] < cfg->succStart[b + 1] && s == NO_BLOCK){
+      s = cfg->succ[nextSucc[depth]++];
+      if(cfg->rank[s] <= cfg->rank[b])
+        s = NO_BLOCK;
+    }
+    if(s == NO_BLOCK){
+      depth--;
+      continue;
+    }
+    path[++depth]   = s;
+    nextSucc[depth] = cfg->succStart[s];
+  }
+  return 0;
+}
+
+/*
+ *  frozenListTillBlock
+ *  getListTillNode on the frozen view, imdDom has to be set first.
+ *  (path) and (nextSucc) are scratch of numOfBlock space.
+ */
+static VersionMap* frozenListTillBlock(FrozenCFG* cfg, int stopBlock, int* path, int* nextSucc){
+  VersionMap* hereList  = createVersionMap(0);
+  int k, length         = 0;
+  int rootBlock         = cfg->imdDom[stopBlock];
+
+  while(rootBlock != NO_BLOCK && cfg->rank[rootBlock] != 0)
+    rootBlock = cfg->imdDom[rootBlock];
+
+  if(rootBlock != NO_BLOCK)
+    length = frozenPathToBlock(cfg, rootBlock, stopBlock, path, nextSucc);
+  for(k = 0; k < length; k++)
+    updateList(cfg->node[path[k]], hereList);
+
+  return hereList;
+}
+
+/*
+ *  lastBrhDomParent
+ *  Parent of (block) inside (lcaIndex), LCA_NO_PARENT for the root or when
+ *  its lastBrhDom is not there or does not come before it in rank
+ */
+static int lastBrhDomParent(FrozenCFG* cfg, LcaIndex* lcaIndex, int block){
+  int lastBrhDom = cfg->lastBrhDom[block];
+
+  if(cfg->parent[block] == NO_BLOCK || lastBrhDom == NO_BLOCK || \
+     cfg->rank[lastBrhDom] >= cfg->rank[block] || !lcaIndexHas(lcaIndex, lastBrhDom))
+    return LCA_NO_PARENT;
+
+  return lastBrhDom;
+}
+
+/**
+ *  frozenSetLastBrhDom
+ *  setLastBrhDom on the frozen view
+ */
+void frozenSetLastBrhDom(FrozenCFG* cfg){
+  if(cfg == NULL)
+    ThrowError(ERR_NULL_NODE, "Empty Tree input detected!");
+
+  int listCapacity    = cfg->numOfEdge;
+  int* blockList      = createBlockArray(listCapacity);
+  int length          = frozenAssembleList(cfg, 0, &blockList, &listCapacity);
+  int *lastBrhDom     = cfg->lastBrhDom;
+  LcaIndex* lcaIndex  = createLcaIndex(cfg->numOfBlock);
+  int b, s, i, k, testRankBlock_1, testRankBlock_2, sameBlock, isIndexValid = 1;
+
+  for(k = 0; k < length; k++){
+    b = blockList[k];
+    if(!lcaIndexHas(lcaIndex, b))
+      lcaIndexPut(lcaIndex, b, lastBrhDomParent(cfg, lcaIndex, b));
+
+    for(i = cfg->succStart[b]; i < cfg->succStart[b + 1]; i++){
+      s = cfg->succ[i];
+      //handle ROOT block
+      if(cfg->parent[b] == NO_BLOCK)
+        lastBrhDom[b] = NO_BLOCK;
+      //handle child with 1 parent only (no assign to lastBrhDom yet)
+      if(lastBrhDom[s] == NO_BLOCK){
+        if(NUM_OF_SUCC(cfg, b) > 1 || cfg->parent[b] == NO_BLOCK)
+          lastBrhDom[s] = b;
+        else if(lastBrhDom[b] != NO_BLOCK)
+          lastBrhDom[s] = lastBrhDom[b];
+      }//handle child with more than 1 parent (lastBrhDom assigned by prev parents)
+      else{
+        testRankBlock_1 = lastBrhDom[b];
+        testRankBlock_2 = lastBrhDom[s];
+        sameBlock       = isIndexValid ? lcaIndexFind(lcaIndex, testRankBlock_1, testRankBlock_2) : LCA_NO_PARENT;
+        if(sameBlock == LCA_NO_PARENT){
+          FIND_SAME_BLOCK(cfg, testRankBlock_1, testRankBlock_2);
+          sameBlock = testRankBlock_1;
+        }
+        lastBrhDom[s] = sameBlock;
+      }
+
+      //a back edge moved the lastBrhDom of a block already in the LcaIndex
+      if(lcaIndexHas(lcaIndex, s) && lcaIndex->up[s] != lastBrhDomParent(cfg, lcaIndex, s))
+        isIndexValid = 0;
+    }
+  }
+
+  for(b = 0; b < cfg->numOfBlock; b++)
+    cfg->node[b]->lastBrhDom = nodeOf(cfg, lastBrhDom[b]);
+  destroyBlockArray(blockList, listCapacity);
+  destroyLcaIndex(lcaIndex);
+}
+
+/*
+ *  frozenUpperDom
+ *  upperDom of NodeChain.c on block id
+ */
+static int frozenUpperDom(FrozenCFG* cfg, int block){
+  if(cfg->rank[block] == 0)
+    return NO_BLOCK;
+  return cfg->imdDom[block] != NO_BLOCK ? cfg->imdDom[block] : cfg->lastBrhDom[block];
+}
+
+/*
+ *  frozenFindImdDom
+ *  findImdDom of NodeChain.c over pred. chain[0 .. chainLength - 1] is
+ *  the chain of the meet so far, chainIndex[b] the place of b inside it
+ *  (only trusted when chain hold b there). Both need numOfBlock space.
+ */
+static int frozenFindImdDom(FrozenCFG* cfg, int block, int* chain, int* chainIndex){
+  int i, p, b, index, start = 0, chainLength = 0;
+
+  for(i = cfg->predStart[block]; i < cfg->predStart[block + 1]; i++){
+    p = cfg->pred[i];
+    if(chainLength == 0){
+      for(b = p; b != NO_BLOCK && b != block; b = frozenUpperDom(cfg, b)){
+        index = chainIndex[b];
+        if(index >= 0 && index < chainLength && chain[index] == b)
+          break;
+        chainIndex[b]        = chainLength;
+        chain[chainLength++] = b;
+      }
+      if(b != NO_BLOCK || cfg->rank[chain[chainLength - 1]] != 0)
+        chainLength = 0;
+      continue;
+    }
+
+    index = NO_BLOCK;
+    for(b = p; b != NO_BLOCK && b != block; b = frozenUpperDom(cfg, b)){
+      index = chainIndex[b];
+      if(index >= 0 && index < chainLength && chain[index] == b)
+        break;
+      index = NO_BLOCK;
+    }
+    if(index != NO_BLOCK && index > start)
+      start = index;
+  }
+
+  return chainLength ? chain[start] : NO_BLOCK;
+}
+
+/**
+ *  frozenSetAllImdDom
+ *  setAllImdDom on the frozen view, one pass over the rank order where
+ *  the imdDom of every block come from its pred
+ */
+void frozenSetAllImdDom(FrozenCFG* cfg){
+  if(cfg == NULL)
+    ThrowError(ERR_NULL_NODE, "Empty Tree input detected!");
+
+  int listCapacity  = cfg->numOfEdge;
+  int* blockList    = createBlockArray(listCapacity);
+  int* chain        = createBlockArray(cfg->numOfBlock);
+  int* chainIndex   = createBlockArray(cfg->numOfBlock);
+  int b, k, length  = frozenAssembleList(cfg, 0, &blockList, &listCapacity);
+
+  for(b = 0; b < cfg->numOfBlock; b++)
+    chainIndex[b] = NO_BLOCK;
+  for(k = 0; k < length; k++)
+    cfg->imdDom[blockList[k]] = NO_BLOCK;
+  for(k = 0; k < length; k++){
+    b = blockList[k];
+    cfg->imdDom[b] = cfg->rank[b] == 0 ? NO_BLOCK : frozenFindImdDom(cfg, b, chain, chainIndex);
+  }
+
+  for(b = 0; b < cfg->numOfBlock; b++)
+    cfg->node[b]->imdDom = nodeOf(cfg, cfg->imdDom[b]);
+  destroyBlockArray(blockList, listCapacity);
+  destroyBlockArray(chain, cfg->numOfBlock);
+  destroyBlockArray(chainIndex, cfg->numOfBlock);
+}
+
+/**
+ *  frozenGetAllDomFrontiers
+ *  getAllDomFrontiers on the frozen view, the runner of Cooper, Harvey
+ *  and Kennedy walk up imdDom from every pred of a block. The edges are
+ *  taken in the same order as getAllDomFrontiers, so the domFrontiers of
+ *  every Node come in the same order. The domFrontiers of every Node is
+ *  replaced and the union of them is returned.
+ */
+Vector* frozenGetAllDomFrontiers(FrozenCFG* cfg){
+  if(cfg == NULL)
+    ThrowError(ERR_NULL_NODE, "Empty Tree input detected!");
+
+  Vector* domFrontiers    = createVector(0);
+  int listCapacity        = cfg->numOfEdge;
+  int* blockList          = createBlockArray(listCapacity);
+  int* checklist          = createBlockArray(cfg->numOfBlock);
+  int* placeOf            = createBlockArray(cfg->numOfBlock);
+  int* inStart            = createBlockArray(cfg->numOfBlock);
+  int* lastFrontier       = createBlockArray(cfg->numOfBlock);
+  int* inPred             = createBlockArray(cfg->numOfEdge);
+  int* edgeOf             = createBlockArray(cfg->numOfEdge);
+  int* headOfEdge         = createBlockArray(cfg->numOfEdge);
+  int* frontierStart      = createBlockArray(cfg->numOfBlock);
+  int length              = frozenAssembleList(cfg, 0, &blockList, &listCapacity);
+  int pairCapacity        = cfg->numOfEdge + 1;
+  FrozenPair* pair        = memAlloc(MEM_LIST, sizeof(FrozenPair) * pairCapacity);
+  BitSet* frontierSet     = createBitSet(cfg->numOfBlock);
+  int *frontierOf;
+  int b, f, i, k, e, runner, numOfChecked = 0, numOfEdge = 0, numOfPair = 0;
+
+  //drop the block frozenAssembleList gave twice and clear the old domFrontiers
+  for(b = 0; b < cfg->numOfBlock; b++){
+    placeOf[b]      = NO_BLOCK;
+    inStart[b]      = 0;
+    lastFrontier[b] = NO_BLOCK;
+  }
+  inStart[cfg->numOfBlock] = 0;
+  for(k = 0; k < length; k++){
+    b = blockList[k];
+    if(placeOf[b] != NO_BLOCK)
+      continue;
+    placeOf[b]                = numOfChecked;
+    checklist[numOfChecked++] = b;
+    numOfEdge                += NUM_OF_SUCC(cfg, b);
+    destroyVector(cfg->node[b]->domFrontiers);
+    cfg->node[b]->domFrontiers = createVector(0);
+  }
+
+  //bucket every edge by its successor, in the order of checklist
+  for(k = 0; k < numOfChecked; k++)
+    for(i = cfg->succStart[checklist[k]]; i < cfg->succStart[checklist[k] + 1]; i++)
+      inStart[cfg->succ[i] + 1]++;
+  for(b = 0; b < cfg->numOfBlock; b++){
+    inStart[b + 1]   += inStart[b];
+    frontierStart[b]  = inStart[b];
+  }
+  for(k = 0, e = 0; k < numOfChecked; k++){
+    b = checklist[k];
+    for(i = cfg->succStart[b]; i < cfg->succStart[b + 1]; i++, e++){
+      inPred[frontierStart[cfg->succ[i]]]   = b;
+      edgeOf[frontierStart[cfg->succ[i]]++] = e;
+    }
+  }
+
+  //walk up from every pred of a block until its imdDom, the edges of one block come together
+  for(e = 0; e < numOfEdge; e++)
+    headOfEdge[e] = NO_BLOCK;
+  for(f = 0; f < cfg->numOfBlock; f++){
+    for(k = inStart[f]; k < inStart[f + 1]; k++){
+      for(runner = inPred[k]; runner != NO_BLOCK && runner != cfg->imdDom[f]; runner = cfg->imdDom[runner]){
+        if(placeOf[runner] == NO_BLOCK || lastFrontier[runner] == f)
+          break;
+        lastFrontier[runner] = f;
+
+        if(numOfPair == pairCapacity){
+          pair = memRealloc(MEM_LIST, pair, sizeof(FrozenPair) * pairCapacity, \
+                            sizeof(FrozenPair) * pairCapacity * 2);
+          pairCapacity *= 2;
+        }
+        pair[numOfPair].block     = runner;
+        pair[numOfPair].frontier  = f;
+        pair[numOfPair].next      = headOfEdge[edgeOf[k]];
+        headOfEdge[edgeOf[k]]     = numOfPair++;
+      }
+    }
+  }
+
+  //hand the pairs out in the order of their edge, frontierOf keep them by block for the union
+  frontierOf = createBlockArray(numOfPair);
+  for(b = 0; b <= cfg->numOfBlock; b++)
+    frontierStart[b] = 0;
+  for(k = 0; k < numOfPair; k++)
+    frontierStart[pair[k].block + 1]++;
+  for(b = 0; b < cfg->numOfBlock; b++){
+    frontierStart[b + 1] += frontierStart[b];
+    lastFrontier[b]       = frontierStart[b];
+  }
+  for(e = 0; e < numOfEdge; e++){
+    for(k = headOfEdge[e]; k != NO_BLOCK; k = pair[k].next){
+      vectorAddLast(cfg->node[pair[k].block]->domFrontiers, cfg->node[pair[k].frontier]);
+      frontierOf[lastFrontier[pair[k].block]++] = pair[k].frontier;
+    }
+  }
+
+  //union of the domFrontiers of each block, in the order of checklist
+  for(k = 0; k < numOfChecked; k++){
+    b = checklist[k];
+    for(i = frontierStart[b]; i < frontierStart[b + 1]; i++){
+      if(!bitSetHas(frontierSet, frontierOf[i])){
+        bitSetAdd(frontierSet, frontierOf[i]);
+        vectorAddLast(domFrontiers, cfg->node[frontierOf[i]]);
+      }
+    }
+  }
+
+  destroyBlockArray(blockList, listCapacity);
+  destroyBlockArray(checklist, cfg->numOfBlock);
+  destroyBlockArray(placeOf, cfg->numOfBlock);
+  destroyBlockArray(inStart, cfg->numOfBlock);
+  destroyBlockArray(lastFrontier, cfg->numOfBlock);
+  destroyBlockArray(inPred, cfg->numOfEdge);
+  destroyBlockArray(edgeOf, cfg->numOfEdge);
+  destroyBlockArray(headOfEdge, cfg->numOfEdge);
+  destroyBlockArray(frontierStart, cfg->numOfBlock);
+  destroyBlockArray(frontierOf, numOfPair);
+  memFree(MEM_LIST, pair, sizeof(FrozenPair) * pairCapacity);
+  destroyBitSet(frontierSet);
+  return domFrontiers;
+}
+
+/**
+ *  frozenAllocPhiFunc
+ *  allocPhiFunc on the frozen view, the predecessor of a join come from
+ *  pred and imdDom has to be set on the frozen view first (by
+ *  frozenSetAllImdDom or frozenAssignAllNodeSSA)
+ */
+void frozenAllocPhiFunc(FrozenCFG* cfg){
+  if(cfg == NULL)
+    ThrowError(ERR_NULL_NODE, "Empty Tree input detected!");
+
+  int* order          = createBlockArray(cfg->numOfBlock);
+  int* dfsParent      = createBlockArray(cfg->numOfBlock);
+  int* liveOrder      = createBlockArray(cfg->numOfBlock);
+  int* path           = createBlockArray(cfg->numOfBlock);
+  int* nextSucc       = createBlockArray(cfg->numOfBlock);
+  int* phiMark        = createVisitMark(cfg);
+  int* liveMark       = createVisitMark(cfg);
+  int length          = frozenPreorder(cfg, 0, phiMark, 1, order, dfsParent);
+  int b, i, k, numOfPred;
+  LinkedList* liveList;
+  VersionMap** predList;
+
+  for(k = 0; k < length; k++){
+    b         = order[k];
+    numOfPred = cfg->predStart[b + 1] - cfg->predStart[b];
+    if(numOfPred < 2)
+      continue;
+
+    //every join start a new live walk, (dfsParent) is not needed any more
+    liveList  = frozenAllLiveList(cfg, b, liveMark, k + 1, liveOrder, dfsParent);
+    predList  = memAlloc(MEM_LIST, sizeof(VersionMap*) * numOfPred);
+    for(i = 0; i < numOfPred; i++)
+      predList[i] = frozenListTillBlock(cfg, cfg->pred[cfg->predStart[b] + i], path, nextSucc);
+
+    addPhiFunc(cfg->node[b], liveList, predList, numOfPred, nodeOf(cfg, cfg->imdDom[b]));
+
+    for(i = 0; i < numOfPred; i++)
+      destroyVersionMap(predList[i]);
+    memFree(MEM_LIST, predList, sizeof(VersionMap*) * numOfPred);
+    destroyLinkedList(liveList);
+  }
+
+  destroyBlockArray(order, cfg->numOfBlock);
+  destroyBlockArray(dfsParent, cfg->numOfBlock);
+  destroyBlockArray(liveOrder, cfg->numOfBlock);
+  destroyBlockArray(path, cfg->numOfBlock);
+  destroyBlockArray(nextSucc, cfg->numOfBlock);
+  destroyBlockArray(phiMark, cfg->numOfBlock);
+  destroyBlockArray(liveMark, cfg->numOfBlock);
+}
+
+/**
+ *  frozenAssignAllNodeSSA
+ *  assignAllNodeSSA on the frozen view, lastBrhDom has to be set first.
+ *  Every imdDom is set by frozenSetAllImdDom before the first block,
+ *  then every block start from the VersionTree left by the block it was
+ *  reached from.
+ */
+void frozenAssignAllNodeSSA(FrozenCFG* cfg, VersionMap* updtList, VersionTree* prevList){
+  if(cfg == NULL)
+    ThrowError(ERR_NULL_NODE, "Empty Tree input detected!");
+
+  int* order          = createBlockArray(cfg->numOfBlock);
+  int* dfsParent      = createBlockArray(cfg->numOfBlock);
+  int* liveOrder      = createBlockArray(cfg->numOfBlock);
+  int* liveParent     = createBlockArray(cfg->numOfBlock);
+  int* ssaMark        = createVisitMark(cfg);
+  int* liveMark       = createVisitMark(cfg);
+  VersionTree** tree  = memAlloc(MEM_LIST, sizeof(VersionTree*) * cfg->numOfBlock);
+  int b, k, length    = frozenPreorder(cfg, 0, ssaMark, 1, order, dfsParent);
+  LinkedList* liveList;
+
+  frozenSetAllImdDom(cfg);
+  for(k = 0; k < length; k++){
+    b = order[k];
+    arrangeSSA(cfg->node[b]);
+    /*  like assignAllNodeSSA the live walk is not started again for every
+        block, a block already walked from an earlier one is left out */
+    liveList = frozenAllLiveList(cfg, b, liveMark, 1, liveOrder, liveParent);
+    tree[b]  = renameNodeSSA(cfg->node[b], liveList, updtList, \
+                             dfsParent[b] == NO_BLOCK ? prevList : tree[dfsParent[b]]);
+  }
+  for(k = 0; k < length; k++)
+    destroyVersionTree(tree[order[k]]);
+
+  destroyBlockArray(order, cfg->numOfBlock);
+  destroyBlockArray(dfsParent, cfg->numOfBlock);
+  destroyBlockArray(liveOrder, cfg->numOfBlock);
+  destroyBlockArray(liveParent, cfg->numOfBlock);
+  destroyBlockArray(ssaMark, cfg->numOfBlock);
+  destroyBlockArray(liveMark, cfg->numOfBlock);
+  memFree(MEM_LIST, tree, sizeof(VersionTree*) * cfg->numOfBlock);
+}
@@ -0,0 +1,69 @@
+#ifndef FrozenCFG_H
+#define FrozenCFG_H
+
+#include "ErrorObject.h"
+#include "NodeChain.h"
+#include "ExpressionBlock.h"
+
+#define NO_BLOCK  -1
+
+/**
+ * FrozenCFG
+ *
+ *  Once a CFG is built with createNode/addChild, freezeCFG pack it into
+ *  compressed sparse row (CSR) arrays. Every reachable Node get a dense
+ *  block id, the root is block 0 and the other follow in breadth first
+ *  order. The passes of the frozen view walk these arrays instead of
+ *  chasing Node** children.
+ *
+ *  FrozenCFG contain:
+ *    1. numOfBlock   number of block (reachable Node)
+ *    2. numOfEdge    number of successor edge
+ *    3. node         node[b] is the Node frozen as block b
+ *    4. succStart    successor of b are succ[succStart[b]] .. succ[succStart[b + 1] - 1]
+ *    5. succ         block id of every successor, in the order of children
+ *    6. predStart    predecessor of b are pred[predStart[b]] .. pred[predStart[b + 1] - 1]
+ *    7. pred         block id of every predecessor, in the order of directDom
+ *    8. rank, parent, lastBrhDom, imdDom
+ *                    one array per attribute of the Node, a block id or
+ *                    NO_BLOCK instead of a Node*
+ *
+ *    succStart [ 0 ][ 2 ][ 3 ][ 4 ][ 4 ]         (A)
+ *                |    |    |    |               /   \
+ *    succ      [ 1 ][ 2 ][ 3 ][ 3 ]           (B)   (C)
+ *               A->B A->C B->D C->D             \   /
+ *                                                (D)
+ *
+ *  Loop over the successor of block b:
+ *    for(i = cfg->succStart[b]; i < cfg->succStart[b + 1]; i++)
+ *      s = cfg->succ[i];
+ *
+ *  The frozen view does not follow a later addChild, splitNode or
+ *  splitCriticalEdges, freeze the graph again after changing it. Every
+ *  frozen pass write its result back to the Node as well, so the Node
+ *  functions see it.
+ */
+typedef struct{
+  int numOfBlock;
+  int numOfEdge;
+  Node** node;
+  int* succStart;
+  int* succ;
+  int* predStart;
+  int* pred;
+  int* rank;
+  int* parent;
+  int* lastBrhDom;
+  int* imdDom;
+}FrozenCFG;
+
+FrozenCFG* freezeCFG(Node** rootNode);
+void destroyFrozenCFG(FrozenCFG* cfg);
+
+void frozenSetLastBrhDom(FrozenCFG* cfg);
+void frozenSetAllImdDom(FrozenCFG* cfg);
+Vector* frozenGetAllDomFrontiers(FrozenCFG* cfg);
+void frozenAllocPhiFunc(FrozenCFG* cfg);
+void frozenAssignAllNodeSSA(FrozenCFG* cfg, VersionMap* updtList, VersionTree* prevList);
+
+#endif // FrozenCFG_H
@@ -1,8 +1,11 @@
 #include "GetList.h"
+#include "VersionTree.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <assert.h>
 
+static void addAllLiveList(Node** inputNode, LinkedList* liveList, VersionMap* liveMap);
+
 /*
  *  getSubsList is a simple function that extract all the
  *  variable in all the expressions in the Node into a LinkedList.
@@ -10,21 +13,21 @@
  *  The function take the input LinkedList* exprList that contain
  *  all the expression in the Node.
  */
-LinkedList* getSubsList(LinkedList* exprList){
+Vector* getSubsList(LinkedList* exprList){
   if(exprList == NULL)
     ThrowError(ERR_NULL_LIST, "Input LinkedList to function getSubsList is NULL");
   
-  LinkedList* subsList = createLinkedList();
+  Vector* subsList     = createVector(exprList->length * 3);
   ListElement* exprPtr = exprList->head;
   
   while(exprPtr != NULL){
     if(((Expression*)exprPtr->node)->opr != IF_STATEMENT){
       if(((Expression*)exprPtr->node)->opr != ASSIGN){
-        addListLast(subsList, &((Expression*)exprPtr->node)->oprdA);
+        vectorAddLast(subsList, &((Expression*)exprPtr->node)->oprdA);
         if(((Expression*)exprPtr->node)->opr != COPY)
-          addListLast(subsList, &((Expression*)exprPtr->node)->oprdB); 
+          vectorAddLast(subsList, &((Expression*)exprPtr->node)->oprdB); 
       }
-      addListLast(subsList, &((Expression*)exprPtr->node)->id);
+      vectorAddLast(subsList, &((Expression*)exprPtr->node)->id);
     }
     exprPtr = exprPtr->next;
   }
@@ -79,73 +82,59 @@ LinkedList* getModifiedList(Node* inputNode){
   
   LinkedList* modifyList  = createLinkedList();
   LinkedList* expList     = inputNode->block;
+  VersionMap* checkMap    = createVersionMap(expList->length);
   
-  ListElement *newPtr, *exprPtr, *checkPtr;
+  ListElement *exprPtr;
+  Subscript *idPtr;
   exprPtr   = expList->head;
   
   /***********************************************************
    * Form modifyList with the modified variable in this block
    ***********************************************************/
   while(exprPtr != NULL){
-    checkPtr = modifyList->head;
-    while(checkPtr != NULL && ((Subscript*)checkPtr->node)->name \
-          != ((Expression*)exprPtr->node)->id.name){
-      checkPtr = checkPtr->next;
-    }
+    idPtr = &((Expression*)exprPtr->node)->id;
     
-    if(checkPtr == NULL && ((Expression*)exprPtr->node)->opr != IF_STATEMENT){
-        if(exprPtr->next == NULL)
-          addListLast(modifyList, &((Expression*)exprPtr->node)->id); 
-        else if(((Expression*)exprPtr->next->node)->opr != IF_STATEMENT)
-          addListLast(modifyList, &((Expression*)exprPtr->node)->id);
+    if(versionMapFind(checkMap, idPtr->name) == NULL && \
+       ((Expression*)exprPtr->node)->opr != IF_STATEMENT){
+      if(exprPtr->next == NULL || ((Expression*)exprPtr->next->node)->opr != IF_STATEMENT){
+        addListLast(modifyList, idPtr);
+        versionMapPut(checkMap, *idPtr, exprPtr->node);
+      }
     }
     exprPtr = exprPtr->next;
   }
+  destroyVersionMap(checkMap);
   
   return modifyList;
 }
 /*
- *  updateList(Node* inputNode, LinkedList* prevList)
+ *  updateList(Node* inputNode, VersionMap* prevList)
  *
  *  This function called the getModifiedList to extract the LHS assigned
  *  subscript in the inputNode and take update the prevList with the
  *  modifiedList.
  *
  ********************************************************************/
-void updateList(Node* inputNode, LinkedList* prevList){
+void updateList(Node* inputNode, VersionMap* prevList){
   if(inputNode == NULL)
     ThrowError(ERR_NULL_NODE, "Input Node to function updateList is NULL");
   
   if(prevList == NULL)
-    ThrowError(ERR_NULL_LIST, "Input LinkedList to function updateList is NULL");
+    ThrowError(ERR_NULL_LIST, "Input VersionMap to function updateList is NULL");
   
-  ListElement *newPtr, *checkPtr;
-
-  // LinkedList* modifiedList = getLatestList(inputNode);
+  Subscript *newSubs;
   LinkedList* modifiedList  = getModifiedList(inputNode);
-  newPtr  = modifiedList->head;
-  while(newPtr != NULL){
-    newPtr->node = getLargestIndex(inputNode->block, (Subscript*)newPtr->node);
-    newPtr = newPtr->next;
-  }
+  ListElement* newPtr       = modifiedList->head;
+  
   /******************************************************
    *  Update the prevList with the modifiedList
    ******************************************************/
-  newPtr    = modifiedList->head;
   while(newPtr != NULL){
-    checkPtr  = prevList->head;
-    while(checkPtr != NULL && ((Subscript*)checkPtr->node)->name \
-                           != ((Subscript*)newPtr->node)->name){
-      checkPtr = checkPtr->next;
-    }
-  
-    if(checkPtr == NULL)
-      addListLast(prevList, (Subscript*)newPtr->node);
-    else
-      checkPtr->node = newPtr->node;
-    
+    newSubs   = getLargestIndex(inputNode->block, (Subscript*)newPtr->node);
+    versionMapPut(prevList, *newSubs, (Expression*)newSubs);
     newPtr = newPtr->next;
   }
+  destroyLinkedList(modifiedList);
 }
 
 /*
@@ -166,6 +155,7 @@ LinkedList* getLiveList(Node** inputNode){
   
   LinkedList* allLiveList = createLinkedList();
   LinkedList* filterList  = createLinkedList();
+  VersionMap* filterMap   = createVersionMap((*inputNode)->block->length * 2);
   ListElement* checkPtr   = (*inputNode)->block->head;
   int checkOpr;
   
@@ -181,15 +171,14 @@ LinkedList* getLiveList(Node** inputNode){
   
   ListElement*  livePtr = allLiveList->head;
   while(livePtr != NULL){
-    checkPtr = filterList->head;
-    while(checkPtr != NULL && ((Subscript*)livePtr->node)->name \
-                        !=  ((Subscript*)checkPtr->node)->name){
-      checkPtr = checkPtr->next;
-    }
-    if(checkPtr == NULL)
+    if(versionMapFind(filterMap, ((Subscript*)livePtr->node)->name) == NULL){
       addListLast(filterList, livePtr->node);
+      versionMapPut(filterMap, *(Subscript*)livePtr->node, NULL);
+    }
     livePtr = livePtr->next;
   }
+  destroyLinkedList(allLiveList);
+  destroyVersionMap(filterMap);
   
   return filterList;
 }
@@ -200,36 +189,62 @@ LinkedList* getLiveList(Node** inputNode){
  *  This function return the latest modified value
  *
  ***********************************************************************/
-LinkedList* getLatestList(Node* inputNode, LinkedList* prevList){
+VersionMap* getLatestList(Node* inputNode, VersionMap* prevList){
   if(inputNode == NULL)
     ThrowError(ERR_NULL_NODE, "Input Node to function getLatestList is NULL");
   
-  LinkedList* modifyList  = getModifiedList(inputNode);
+  LinkedList* modifyList    = getModifiedList(inputNode);
+  VersionMap* latestList    = createVersionMap(modifyList->length + prevList->length);
   
-  ListElement*  checkPtr;
-  ListElement*  newPtr    = modifyList->head;
+  Subscript*    newSubs;
+  ListElement*  newPtr      = modifyList->head;
   while(newPtr != NULL){
-    newPtr->node = getLargestIndex(inputNode->block, (Subscript*)newPtr->node);
-    newPtr = newPtr->next;
+    newSubs = getLargestIndex(inputNode->block, (Subscript*)newPtr->node);
+    versionMapPut(latestList, *newSubs, (Expression*)newSubs);
+    newPtr  = newPtr->next;
   }
   /******************************************************
    *  Update the prevList with the modifiedList
    ******************************************************/
-  newPtr    = prevList->head;
-  while(newPtr != NULL){
-    checkPtr  = modifyList->head;
-    while(checkPtr != NULL && ((Subscript*)checkPtr->node)->name \
-                           != ((Subscript*)newPtr->node)->name){
-      checkPtr = checkPtr->next;
-    }
+  int i;
+  for(i = 0; i < prevList->length; i++){
+    if(versionMapFind(latestList, prevList->item[i].name) == NULL)
+      versionMapPut(latestList, prevList->item[i], prevList->defSite[i]);
+  }
+  destroyLinkedList(modifyList);
   
-    if(checkPtr == NULL)
-      addListLast(modifyList, (Subscript*)newPtr->node);
-    
-    newPtr = newPtr->next;
+  return latestList;
+}
+
+/*
+ *  getLatestTree(Node* inputNode, VersionTree* prevTree)
+ *
+ *  Same as getLatestList but the prevTree is not copied, only the
+ *  variables modified in the inputNode are put into a new version
+ *  of the prevTree. prevTree itself stay unchanged, the tree returned
+ *  has to be given back with destroyVersionTree.
+ *
+ ***********************************************************************/
+VersionTree* getLatestTree(Node* inputNode, VersionTree* prevTree){
+  if(inputNode == NULL)
+    ThrowError(ERR_NULL_NODE, "Input Node to function getLatestTree is NULL");
+  
+  LinkedList* modifyList  = getModifiedList(inputNode);
+  ListElement* newPtr     = modifyList->head;
+  VersionTree* latestTree = shareVersionTree(prevTree);
+  VersionTree* newTree;
+  Subscript* newSubs;
+  
+  while(newPtr != NULL){
+    newSubs     = getLargestIndex(inputNode->block, (Subscript*)newPtr->node);
+    newTree     = versionTreePut(latestTree, *newSubs, (Expression*)newSubs);
+    destroyVersionTree(latestTree);
+    latestTree  = newTree;
+    newPtr      = newPtr->next;
   }
+  destroyLinkedList(modifyList);
   
-  return modifyList;
+  return latestTree;
 }
 
 /*
@@ -239,20 +254,21 @@ LinkedList* getLatestList(Node* inputNode, LinkedList* prevList){
  *  from the entry until the input stopNode
  *
  *****************************************************************/
-LinkedList* getListTillNode(Node* stopNode){
+VersionMap* getListTillNode(Node* stopNode){
   assert(stopNode != NULL);
   Node* rootNode = stopNode->imdDom;
   while(rootNode->rank != 0)
     rootNode = rootNode->imdDom;
   
-  LinkedList* hereList = createLinkedList();
-  LinkedList* pathList = getPathToNode(&rootNode, stopNode);
-  ListElement* pathPtr = pathList->head;
+  VersionMap* hereList    = createVersionMap(0);
+  LinkedList* pathList    = getPathToNode(&rootNode, stopNode);
+  ListElement* pathPtr    = pathList->head;
   
   while(pathPtr != NULL){
     updateList(pathPtr->node, hereList);
     pathPtr = pathPtr->next;
   }
+  destroyLinkedList(pathList);
   
   return hereList;
 }
@@ -281,8 +297,10 @@ LinkedList* getPathToNode(Node** rootNode, Node* stopNode){
   if((*rootNode)->rank < stopNode->rank){
     for(i = 0; i < (*rootNode)->numOfChild; i++){
       childPtr  = (*rootNode)->children[i];
-      if(pathList->length == 0 && childPtr->rank > (*rootNode)->rank)
+      if(pathList->length == 0 && childPtr->rank > (*rootNode)->rank){
+        destroyLinkedList(pathList);
         pathList = getPathToNode(&childPtr, stopNode);
+      }
     }
     if(pathList->length != 0)
       addListFirst(pathList, (*rootNode));
@@ -294,7 +312,7 @@ LinkedList* getPathToNode(Node** rootNode, Node* stopNode){
       return pathList;
     }
     else
-      return createLinkedList();
+      return pathList;
   }
 }
 
@@ -315,29 +333,42 @@ LinkedList* getAllLiveList(Node** inputNode, LinkedList* prevLiveList){
   if(prevLiveList == NULL)
     prevLiveList = createLinkedList();
   
-  (*inputNode)->visitFlag |= 4;
+  VersionMap* liveMap   = createVersionMap(prevLiveList->length);
+  ListElement* prevPtr  = prevLiveList->head;
+  while(prevPtr != NULL){
+    versionMapPut(liveMap, *(Subscript*)prevPtr->node, NULL);
+    prevPtr = prevPtr->next;
+  }
+  
+  addAllLiveList(inputNode, prevLiveList, liveMap);
+  destroyVersionMap(liveMap);
+  return prevLiveList;
+}
+
+/*
+ *  addAllLiveList
+ *  Recursive part of getAllLiveList, (liveMap) hold the name of
+ *  every subscript already inside (liveList)
+ */
+static void addAllLiveList(Node** inputNode, LinkedList* liveList, VersionMap* liveMap){
+  markVisited(*inputNode, VISIT_LIVE);
   LinkedList* thisLiveList = getLiveList(inputNode);
-  ListElement *prevPtr = prevLiveList->head; 
   ListElement *thisPtr = thisLiveList->head;
   int i;
   
   while(thisPtr != NULL){
-    prevPtr = prevLiveList->head;
-    while(prevPtr != NULL && ((Subscript*)prevPtr->node)->name \
-                          != ((Subscript*)thisPtr->node)->name){
-      prevPtr = prevPtr->next;
-    } 
-    if(prevPtr == NULL)
-      addListLast(prevLiveList, (Subscript*)thisPtr->node);
+    if(versionMapFind(liveMap, ((Subscript*)thisPtr->node)->name) == NULL){
+      addListLast(liveList, (Subscript*)thisPtr->node);
+      versionMapPut(liveMap, *(Subscript*)thisPtr->node, NULL);
+    }
     thisPtr = thisPtr->next;
   }
   
   for(i = 0; i < (*inputNode)->numOfChild; i++){
-    if(((*inputNode)->children[i]->visitFlag & 4) == 0)
-      prevLiveList = getAllLiveList(&(*inputNode)->children[i], prevLiveList); 
+    if(!isVisited((*inputNode)->children[i], VISIT_LIVE))
+      addAllLiveList(&(*inputNode)->children[i], liveList, liveMap);
   }
-  
-  return prevLiveList;
+  destroyLinkedList(thisLiveList);
 }
 
 
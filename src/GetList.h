@@ -2,23 +2,26 @@
 #define GetList_H
 
 #include "LinkedList.h"
+#include "Vector.h"
 #include "ErrorObject.h"
 #include "ExpressionBlock.h"
 #include "NodeChain.h"
+#include "VersionMap.h"
 #include "ErrorObject.h"
 
 //********** Function that check only the input Node ******************
 LinkedList* getModifiedList(Node* inputNode);
 LinkedList* getLiveList(Node** inputNode);
-LinkedList* getLatestList(Node* inputNode, LinkedList* prevList);
+VersionMap* getLatestList(Node* inputNode, VersionMap* prevList);
+VersionTree* getLatestTree(Node* inputNode, VersionTree* prevTree);
 LinkedList* getPathToNode(Node** rootNode, Node* stopNode);
 Subscript* getLargestIndex(LinkedList* subsList, Subscript* subsName);
-LinkedList* getSubsList(LinkedList* expression);
-void updateList(Node* inputNode, LinkedList* prevList);
+Vector* getSubsList(LinkedList* expression);
+void updateList(Node* inputNode, VersionMap* prevList);
 
 //************ Function that will traverse the input Node **************
 LinkedList* getAllLiveList(Node** inputNode, LinkedList* prevLiveList);
-LinkedList* getListTillNode(Node* stopNode);
+VersionMap* getListTillNode(Node* stopNode);
 
 
 
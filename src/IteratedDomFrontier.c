@@ -0,0 +1,145 @@
+#include "IteratedDomFrontier.h"
+#include "Allocator.h"
+#include <stdlib.h>
+
+#define EMPTY_BANK  -1
+
+static int* createIndexArray(int length){
+  return memAlloc(MEM_LIST, sizeof(int) * (length + 1));
+}
+
+static void destroyIndexArray(int* array, int length){
+  memFree(MEM_LIST, array, sizeof(int) * (length + 1));
+}
+
+/*
+ *  putIntoBank
+ *  Put the preorder number (p) into the bucket of its level, once only
+ */
+static void putIntoBank(DomTree* tree, int p, int* bankHead, int* bankNext, BitSet* bankedSet){
+  if(bitSetHas(bankedSet, p))
+    return;
+
+  bitSetAdd(bankedSet, p);
+  bankNext[p]                 = bankHead[tree->level[p]];
+  bankHead[tree->level[p]]    = p;
+}
+
+/**
+ *  getIteratedDomFrontiers
+ *  Return the iterated domFrontiers of the nodes in (defNode), in
+ *  preorder of the dominator tree. A node that cannot be reached from the
+ *  root of (tree) is ignored.
+ */
+Vector* getIteratedDomFrontiers(DomTree* tree, Vector* defNode){
+  if(tree == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: DomTree cannot be NULL!");
+  if(defNode == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: Vector cannot be NULL!");
+
+  int n               = tree->numOfNode;
+  int* bankHead       = createIndexArray(n);
+  int* bankNext       = createIndexArray(n);
+  int* stack          = createIndexArray(n);
+  BitSet* bankedSet   = createBitSet(n);
+  BitSet* visitedSet  = createBitSet(n);
+  BitSet* phiSet      = createBitSet(n);
+  Vector* phiNode     = createVector(0);
+  Node* nodePtr;
+  int i, k, p, y, z, top, rootLevel, currentLevel = n - 1;
+
+  for(k = 0; k < n; k++)
+    bankHead[k] = EMPTY_BANK;
+
+  for(k = 0; k < defNode->length; k++){
+    p = domTreeIndexOf(tree, defNode->item[k]);
+    if(p != NOT_IN_DOM_TREE)
+      putIntoBank(tree, p, bankHead, bankNext, bankedSet);
+  }
+
+  while(1){
+    while(currentLevel >= 0 && bankHead[currentLevel] == EMPTY_BANK)
+      currentLevel--;
+    if(currentLevel < 0)
+      break;
+
+    p                       = bankHead[currentLevel];
+    bankHead[currentLevel]  = bankNext[p];
+    rootLevel               = tree->level[p];
+
+    /*  walk the subtree of p down the D-edge, the walked part was already done by a deeper node */
+    top = 0;
+    bitSetAdd(visitedSet, p);
+    stack[top++] = p;
+    while(top > 0){
+      y       = stack[--top];
+      nodePtr = tree->node[y];
+
+      for(i = 0; i < nodePtr->numOfChild; i++){
+        z = domTreeIndexOf(tree, nodePtr->children[i]);
+        if(z == NOT_IN_DOM_TREE || tree->imdDom[z] == y)
+          continue;
+        if(tree->level[z] <= rootLevel && !bitSetHas(phiSet, z)){
+          bitSetAdd(phiSet, z);
+          putIntoBank(tree, z, bankHead, bankNext, bankedSet);
+        }
+      }
+
+      for(i = tree->childStart[y]; i < tree->childStart[y + 1]; i++){
+        if(!bitSetHas(visitedSet, tree->child[i])){
+          bitSetAdd(visitedSet, tree->child[i]);
+          stack[top++] = tree->child[i];
+        }
+      }
+    }
+  }
+
+  for(p = bitSetNext(phiSet, 0); p != -1; p = bitSetNext(phiSet, p + 1))
+    vectorAddLast(phiNode, tree->node[p]);
+
+  destroyIndexArray(bankHead, n);
+  destroyIndexArray(bankNext, n);
+  destroyIndexArray(stack, n);
+  destroyBitSet(bankedSet);
+  destroyBitSet(visitedSet);
+  destroyBitSet(phiSet);
+  return phiNode;
+}
+
+/**
+ *  getDefNodes
+ *  Return the nodes of (tree) holding an Expression that assign the
+ *  variable (subsName), in preorder
+ */
+Vector* getDefNodes(DomTree* tree, int subsName){
+  if(tree == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: DomTree cannot be NULL!");
+
+  Vector* defNode = createVector(0);
+  ListElement* exprPtr;
+  int p;
+
+  for(p = 0; p < tree->numOfNode; p++){
+    for(exprPtr = tree->node[p]->block->head; exprPtr != NULL; exprPtr = exprPtr->next){
+      if(((Expression*)exprPtr->node)->opr != IF_STATEMENT && \
+         ((Expression*)exprPtr->node)->id.name == subsName){
+        vectorAddLast(defNode, tree->node[p]);
+        break;
+      }
+    }
+  }
+  return defNode;
+}
+
+/**
+ *  getPhiNodes
+ *  Return the nodes that need a phiFunction of the variable (subsName),
+ *  that is the iterated domFrontiers of the nodes assigning it
+ */
+Vector* getPhiNodes(DomTree* tree, int subsName){
+  Vector* defNode = getDefNodes(tree, subsName);
+  Vector* phiNode = getIteratedDomFrontiers(tree, defNode);
+
+  destroyVector(defNode);
+  return phiNode;
+}
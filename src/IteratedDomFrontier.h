@@ -0,0 +1,35 @@
+#ifndef IteratedDomFrontier_H
+#define IteratedDomFrontier_H
+
+#include "ErrorObject.h"
+#include "BitSet.h"
+#include "NodeChain.h"
+#include "ExpressionBlock.h"
+#include "DomTree.h"
+
+/**
+ * Iterated dominance frontier
+ *
+ *  The phiFunction of a variable are needed in the iterated domFrontiers
+ *  of the nodes defining it, DF+(S) = DF(S) U DF(DF(S)) U ... . They are
+ *  found on the DJ-graph (Sreedhar and Gao), the D-edge are the edges of
+ *  the dominator tree and the J-edge are the CFG edges y -> z where y is
+ *  not the imdDom of z.
+ *
+ *  The nodes wait in a piggy bank, one bucket per level of the tree. The
+ *  deepest node is taken out and its subtree walked, a J-edge y -> z with
+ *  level(z) <= level of the node taken out put z into DF+. Every node is
+ *  walked once, so one variable cost O(node + edge) and nothing has to be
+ *  kept between two variables.
+ *
+ *       [A]                 defined in B        DF+ = { D, A }
+ *      /   \                    D-edge  A -> B, A -> C, A -> D
+ *    [B]   [C]                  J-edge  B -> D, C -> D, D -> A
+ *      \   /
+ *       [D] >> A
+ */
+Vector* getIteratedDomFrontiers(DomTree* tree, Vector* defNode);
+Vector* getDefNodes(DomTree* tree, int subsName);
+Vector* getPhiNodes(DomTree* tree, int subsName);
+
+#endif // IteratedDomFrontier_H
@@ -0,0 +1,105 @@
+#include "LcaIndex.h"
+#include "Allocator.h"
+#include <stdlib.h>
+
+#define UP(index, level, slot)   ((index)->up[(level) * (index)->numOfSlot + (slot)])
+
+/**
+ * createLcaIndex
+ *  Calling the function will generate an LcaIndex without any slot put
+ *
+ *  numOfSlot  every slot put will be smaller than numOfSlot
+ */
+LcaIndex* createLcaIndex(int numOfSlot){
+  LcaIndex* newIndex = memAlloc(MEM_LIST, sizeof(LcaIndex));
+  int s;
+
+  if(numOfSlot < 1)
+    numOfSlot = 1;
+
+  newIndex->numOfSlot   = numOfSlot;
+  newIndex->numOfLevel  = 1;
+  while((1 << newIndex->numOfLevel) < numOfSlot)
+    newIndex->numOfLevel++;
+
+  newIndex->depth = memAlloc(MEM_LIST, sizeof(int) * numOfSlot);
+  newIndex->up    = memAlloc(MEM_LIST, sizeof(int) * numOfSlot * newIndex->numOfLevel);
+  for(s = 0; s < numOfSlot; s++)
+    newIndex->depth[s] = -1;
+
+  return newIndex;
+}
+
+void destroyLcaIndex(LcaIndex* index){
+  if(index == NULL)
+    return;
+
+  memFree(MEM_LIST, index->depth, sizeof(int) * index->numOfSlot);
+  memFree(MEM_LIST, index->up, sizeof(int) * index->numOfSlot * index->numOfLevel);
+  memFree(MEM_LIST, index, sizeof(LcaIndex));
+}
+
+int lcaIndexHas(LcaIndex* index, int slot){
+  if(index == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: LcaIndex cannot be NULL!");
+
+  return slot >= 0 && slot < index->numOfSlot && index->depth[slot] >= 0;
+}
+
+/**
+ * lcaIndexPut
+ *  Put (slot) under (parentSlot), LCA_NO_PARENT make it a root. The
+ *  parent must be put first.
+ */
+void lcaIndexPut(LcaIndex* index, int slot, int parentSlot){
+  int j;
+
+  if(index == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: LcaIndex cannot be NULL!");
+
+  if(slot < 0 || slot >= index->numOfSlot)
+    ThrowError(ERR_INDEX_OUT_OF_RANGE, "Slot %d is out of the LcaIndex", slot);
+
+  if(parentSlot != LCA_NO_PARENT && !lcaIndexHas(index, parentSlot))
+    ThrowError(ERR_INDEX_OUT_OF_RANGE, "Parent %d of slot %d is not put yet", parentSlot, slot);
+
+  index->depth[slot]  = parentSlot == LCA_NO_PARENT ? 0 : index->depth[parentSlot] + 1;
+  UP(index, 0, slot)  = parentSlot;
+  for(j = 1; j < index->numOfLevel; j++)
+    UP(index, j, slot) = UP(index, j - 1, slot) == LCA_NO_PARENT ? \
+                         LCA_NO_PARENT : UP(index, j - 1, UP(index, j - 1, slot));
+}
+
+/**
+ * lcaIndexFind
+ *  return the lowest common ancestor of (slotA) and (slotB), a slot is
+ *  an ancestor of itself. LCA_NO_PARENT is returned when they are in two
+ *  different tree or one of them is not put.
+ */
+int lcaIndexFind(LcaIndex* index, int slotA, int slotB){
+  int j, temp;
+
+  if(!lcaIndexHas(index, slotA) || !lcaIndexHas(index, slotB))
+    return LCA_NO_PARENT;
+
+  if(index->depth[slotA] < index->depth[slotB]){
+    temp  = slotA;
+    slotA = slotB;
+    slotB = temp;
+  }
+
+  for(j = index->numOfLevel - 1; j >= 0; j--)
+    if(index->depth[slotA] - (1 << j) >= index->depth[slotB])
+      slotA = UP(index, j, slotA);
+
+  if(slotA == slotB)
+    return slotA;
+
+  for(j = index->numOfLevel - 1; j >= 0; j--){
+    if(UP(index, j, slotA) != UP(index, j, slotB)){
+      slotA = UP(index, j, slotA);
+      slotB = UP(index, j, slotB);
+    }
+  }
+  return UP(index, 0, slotA);
+}
@@ -0,0 +1,44 @@
+#ifndef LcaIndex_H
+#define LcaIndex_H
+
+#include "ErrorObject.h"
+
+#define LCA_NO_PARENT  -1
+
+/**
+ * LcaIndex
+ *
+ *  Object of LcaIndex's type answer the lowest common ancestor of two
+ *  slot of a forest in O(log n) by binary lifting. A slot is a small
+ *  non-negative number (a position in a node list, a block id ...) and
+ *  the forest grow from the root down, a slot is put once, after its
+ *  parent.
+ *
+ *  LcaIndex contain:
+ *    1. numOfSlot    number of slot that can be put
+ *    2. numOfLevel   number of jump kept for every slot
+ *    3. depth        depth[s] is 0 for a root, -1 when s is not put yet
+ *    4. up           up[j * numOfSlot + s] is the (2 ^ j)th ancestor of s
+ *                    or LCA_NO_PARENT
+ *
+ *        0            s  depth  up[0]  up[1]
+ *        |            0    0     -1     -1
+ *        1            1    1      0     -1
+ *       / \           2    2      1      0
+ *      2   3          3    2      1      0
+ */
+typedef struct{
+  int numOfSlot;
+  int numOfLevel;
+  int* depth;
+  int* up;
+}LcaIndex;
+
+LcaIndex* createLcaIndex(int numOfSlot);
+void destroyLcaIndex(LcaIndex* index);
+
+void lcaIndexPut(LcaIndex* index, int slot, int parentSlot);
+int lcaIndexHas(LcaIndex* index, int slot);
+int lcaIndexFind(LcaIndex* index, int slotA, int slotB);
+
+#endif // LcaIndex_H
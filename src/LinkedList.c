@@ -1,7 +1,7 @@
 #include "LinkedList.h"
+#include "Allocator.h"
 #include <stdio.h>
 #include <stdlib.h>
-#include <malloc.h>
 #include <assert.h>
 
 /**
@@ -20,6 +20,7 @@
  *	ListElement type object contain:
  *		1. an integer
  *		2. a pointer to the next ListElement object
+ *		3. a pointer to the previous ListElement object
  *
  *	ListElement type object is basically a node that can extend to store more value
  *
@@ -30,7 +31,7 @@
 
 
 LinkedList* createLinkedList(){
-	LinkedList* newList = malloc(sizeof(LinkedList));
+	LinkedList* newList = memAlloc(MEM_LIST, sizeof(LinkedList));
 	assert(newList != NULL);
 
 	newList-> head	= NULL;
@@ -41,10 +42,11 @@ LinkedList* createLinkedList(){
 }
 
 ListElement* createListElement(void *data){
-	ListElement* newElement = malloc(sizeof(ListElement));
+	ListElement* newElement = memAlloc(MEM_LIST, sizeof(ListElement));
 
 	newElement->node = data;
 	newElement->next = NULL;
+	newElement->prev = NULL;
 
 	return newElement;
 }
@@ -60,17 +62,14 @@ void addListLast(LinkedList* currentList, void *data){
   }
 
   ListElement* newElement = createListElement(data);
-  ListElement* tempNode = currentList->head;
   //check if the linked list empty. If empty, create a Node that the head point to
   if(currentList->head == NULL){
     currentList->head = newElement;
   }
-  //if the list is not empty, find the last node and add a node as new last node
+  //if the list is not empty, the tail is the last node, add a node behind it
   else{
-    while(tempNode->next != NULL){
-      tempNode = tempNode->next;
-    }
-    tempNode->next = newElement;
+    newElement->prev = currentList->tail;
+    currentList->tail->next = newElement;
   }
   //No matter what, the tail always point to last node
   currentList->tail = newElement;
@@ -91,77 +90,107 @@ void addListFirst(LinkedList* currentList, void *data){
   
   if(currentList->length == 0)
     currentList->tail = newElement;
+  else
+    prevHead->prev = newElement;
   
   currentList->head->next = prevHead;
   currentList->tail->next = NULL; //Tail->next permanently pointing to NULL
   (currentList->length)++;
 }
 
+/**
+ * listRemoveElement
+ *  Unlink the element from the list without walking the list.
+ *  The element must belong to the list. Its node stay untouched
+ *  and the element can be reused by the caller.
+ */
+void listRemoveElement(LinkedList* link, ListElement* element){
+  if(link == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: Link List cannot be NULL!");
+
+  if(element == NULL)
+    ThrowError(ERR_NULL_ELEMENT, "ERROR: Element cannot be NULL!");
+
+  if(element->prev != NULL)
+    element->prev->next = element->next;
+  else
+    link->head = element->next;
+
+  if(element->next != NULL)
+    element->next->prev = element->prev;
+  else
+    link->tail = element->prev;
+
+  element->next = NULL;
+  element->prev = NULL;
+  link->length --;
+}
+
 ListElement* listRemoveFirst(LinkedList* link){
   ListElement* removedElement;
 
-  if(link == NULL){
-    removedElement = NULL;
+  if(link == NULL)
     ThrowError(ERR_NULL_LIST, "ERROR: Link List cannot be NULL!");
-  }
 
-  if(link->head == NULL){
-    removedElement = NULL;
+  if(link->head == NULL)
     ThrowError(ERR_EMPTY_LIST, "Nothing to remove, empty list here! Return empty element");
-  }
 
-  removedElement = malloc(sizeof(ListElement));
   removedElement = link->head;
-  if(link->head->next != NULL)
-    link->head = link->head->next;
-  else{
-    link->head = NULL;
-    link->tail = NULL;
-  }
-  removedElement->next = NULL;
-  link->length --;
+  listRemoveElement(link, removedElement);
 
   return removedElement;
 }
 
 ListElement* listRemoveLast(LinkedList* link){
   ListElement* removedElement;
-  ListElement* tempNode = malloc(sizeof(ListElement));
 
-  if(link == NULL){
-    removedElement = NULL;
+  if(link == NULL)
     ThrowError(ERR_NULL_LIST, "ERROR: Link List cannot be NULL!");
-  }
-  if(link->head == NULL){
-    removedElement = NULL;
+
+  if(link->head == NULL)
     ThrowError(ERR_EMPTY_LIST, "Nothing to remove, empty list here! Return empty element");
-  }
 
-  tempNode = link->head;
-  removedElement = malloc(sizeof(ListElement));
   removedElement = link->tail;
-  if(tempNode->next != NULL){
-    while(tempNode->next != link->tail){
-      tempNode = tempNode->next;
-    }
-    link->tail = tempNode;
-    tempNode->next = NULL;
-  }
-  else{
-    link->head = NULL;
-    link->tail = NULL;
-  }
-  link->length --;
+  listRemoveElement(link, removedElement);
 
   return removedElement;
 }
 
+/**
+ * destroyListElement
+ *  Give back an element returned by listRemoveFirst/listRemoveLast,
+ *  the node it point to is not freed.
+ */
+void destroyListElement(ListElement* element){
+  memFree(MEM_LIST, element, sizeof(ListElement));
+}
 
+/**
+ * destroyLinkedList
+ *  Free the list and every element of it, the nodes the elements point
+ *  to are not freed as they may still be used somewhere else.
+ *
+ * destroyLinkedListWithPayload
+ *  Same as destroyLinkedList but (destroyPayload) is called for the node
+ *  of every element before the element is freed.
+ */
+void destroyLinkedList(LinkedList* link){
+  destroyLinkedListWithPayload(link, NULL);
+}
 
+void destroyLinkedListWithPayload(LinkedList* link, void (*destroyPayload)(void* payload)){
+  ListElement *elementPtr, *nextPtr;
 
+  if(link == NULL)
+    return;
 
-
-
-
-
-
+  elementPtr = link->head;
+  while(elementPtr != NULL){
+    nextPtr = elementPtr->next;
+    if(destroyPayload != NULL)
+      destroyPayload(elementPtr->node);
+    destroyListElement(elementPtr);
+    elementPtr = nextPtr;
+  }
+  memFree(MEM_LIST, link, sizeof(LinkedList));
+}
@@ -23,18 +23,27 @@
  *	ListElement type object contain:
  *		1. an integer
  *		2. a pointer pointing to the next ListElement object
+ *		3. a pointer pointing to the previous ListElement object
  *	
  *	ListElement type object is basically a node that can extend to
  *	to store more value when needed.
  *
  *	It extend by pointing to another ListElement object.
  *	If no more node behind, the pointer point to NULL
+ *	If no more node in front, prev point to NULL
+ *
+ *	As every element know both neighbour, adding or removing at both end
+ *	and unlinking any element of the list does not need to walk the list.
+ *
+ *	An element taken out by listRemoveFirst/listRemoveLast belong to the
+ *	caller, give it back with destroyListElement when it is not needed.
  *
  */
 typedef struct ListElement_t ListElement;
 struct ListElement_t{
 	void* node;
 	ListElement* next;
+	ListElement* prev;
 };
 
 typedef struct{
@@ -51,6 +60,11 @@ void addListFirst(LinkedList* currentList, void *data);
 
 ListElement* listRemoveFirst(LinkedList* link);
 ListElement* listRemoveLast(LinkedList* link);
+void listRemoveElement(LinkedList* link, ListElement* element);
+
+void destroyListElement(ListElement* element);
+void destroyLinkedList(LinkedList* link);
+void destroyLinkedListWithPayload(LinkedList* link, void (*destroyPayload)(void* payload));
 
 
 #endif // LinkedList_H
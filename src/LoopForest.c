@@ -0,0 +1,435 @@
+#include "LoopForest.h"
+#include "Allocator.h"
+#include <stdlib.h>
+
+#define NOT_A_HEADER  -1
+
+static int* createIndexArray(int length){
+  return memAlloc(MEM_LIST, sizeof(int) * (length + 1));
+}
+
+static void destroyIndexArray(int* array, int length){
+  memFree(MEM_LIST, array, sizeof(int) * (length + 1));
+}
+
+/*
+ *  ExtraPred
+ *  The edges entering an irreducible loop past its header are moved to
+ *  the header while the loops are collapsed. They are kept in one pool,
+ *  first[p] .. next[e] is the chain of extra predecessor of p.
+ */
+typedef struct{
+  int* first;
+  int* pred;
+  int* next;
+  int length;
+  int capacity;
+}ExtraPred;
+
+static void addExtraPred(ExtraPred* extra, int p, int predNum){
+  if(extra->length == extra->capacity){
+    extra->pred = memRealloc(MEM_LIST, extra->pred, sizeof(int) * extra->capacity, \
+                             sizeof(int) * extra->capacity * 2);
+    extra->next = memRealloc(MEM_LIST, extra->next, sizeof(int) * extra->capacity, \
+                             sizeof(int) * extra->capacity * 2);
+    extra->capacity *= 2;
+  }
+  extra->pred[extra->length] = predNum;
+  extra->next[extra->length] = extra->first[p];
+  extra->first[p]            = extra->length++;
+}
+
+/*
+ *  findHeader
+ *  Union-find over the collapsed loops, return the outermost header found
+ *  so far of the loop (p) is in, (p) itself when it is in none yet
+ */
+static int findHeader(int* unionOf, int p){
+  int root = p, nextNum;
+
+  while(unionOf[root] != root)
+    root = unionOf[root];
+  while(unionOf[p] != root){
+    nextNum    = unionOf[p];
+    unionOf[p] = root;
+    p          = nextNum;
+  }
+  return root;
+}
+
+/*
+ *  numberNode
+ *  Depth first walk from the root, fill node in preorder, number the
+ *  nodes with INDEX_LOOP and give lastNum[p], the biggest preorder number
+ *  inside the subtree of p. node, lastNum and (nextChild) hold every
+ *  reachable node, forest->numOfNode count the nodes numbered so far.
+ */
+static void numberNode(LoopForest* forest, Node* rootNode, int* lastNum, int* nextChild){
+  Vector* stack = createVector(0);
+  Node *nodePtr, *childPtr;
+  int pre = 0;
+
+  forest->node[pre] = rootNode;
+  rootNode->nodeIndex[INDEX_LOOP] = pre;
+  nextChild[pre++]  = 0;
+  forest->numOfNode = pre;
+  vectorAddLast(stack, rootNode);
+
+  while(stack->length > 0){
+    nodePtr = VECTOR_LAST(stack);
+    if(nextChild[nodePtr->nodeIndex[INDEX_LOOP]] == nodePtr->numOfChild){
+      lastNum[nodePtr->nodeIndex[INDEX_LOOP]] = pre - 1;
+      vectorRemoveLast(stack);
+      continue;
+    }
+
+    childPtr = nodePtr->children[nextChild[nodePtr->nodeIndex[INDEX_LOOP]]++];
+    if(loopForestIndexOf(forest, childPtr) == NOT_IN_LOOP){
+      forest->node[pre] = childPtr;
+      childPtr->nodeIndex[INDEX_LOOP] = pre;
+      nextChild[pre++]  = 0;
+      forest->numOfNode = pre;
+      vectorAddLast(stack, childPtr);
+    }
+  }
+
+  destroyVector(stack);
+}
+
+/*
+ *  fillLatches
+ *  The latches of every loop are the back edge predecessor of its header
+ */
+static void fillLatches(LoopForest* forest, int* predStart, int* pred, int* lastNum){
+  int l, k, h, count = 0;
+
+  for(l = 0; l < forest->numOfLoop; l++){
+    h = forest->header[l];
+    for(k = predStart[h]; k < predStart[h + 1]; k++)
+      if(h <= pred[k] && pred[k] <= lastNum[h])
+        count++;
+  }
+
+  forest->latchStart = createIndexArray(forest->numOfLoop);
+  forest->latch      = createIndexArray(count);
+  count = 0;
+  for(l = 0; l < forest->numOfLoop; l++){
+    forest->latchStart[l] = count;
+    h = forest->header[l];
+    for(k = predStart[h]; k < predStart[h + 1]; k++)
+      if(h <= pred[k] && pred[k] <= lastNum[h])
+        forest->latch[count++] = pred[k];
+  }
+  forest->latchStart[forest->numOfLoop] = count;
+}
+
+static int loopContainsNum(LoopForest* forest, int loop, int p){
+  int l = forest->loopOf[p];
+
+  while(l > loop)
+    l = forest->parent[l];
+  return l == loop && loop != NOT_IN_LOOP;
+}
+
+/*
+ *  fillExits
+ *  An edge p -> s leave every loop around p that does not hold s, these
+ *  loops are the innermost loop of p and its parents up to the first one
+ *  holding s. A node reached by many edges is kept once per loop.
+ */
+static void fillExits(LoopForest* forest){
+  int n = forest->numOfNode, numOfLoop = forest->numOfLoop;
+  int* exitCount  = createIndexArray(numOfLoop);
+  int* mark       = createIndexArray(n);
+  int *allExit, *allStart;
+  int p, s, i, l, k, total = 0, count = 0;
+  Node* nodePtr;
+
+  for(l = 0; l <= numOfLoop; l++)
+    exitCount[l] = 0;
+  for(p = 0; p < n; p++){
+    nodePtr = forest->node[p];
+    for(i = 0; i < nodePtr->numOfChild; i++){
+      s = nodePtr->children[i]->nodeIndex[INDEX_LOOP];
+      for(l = forest->loopOf[p]; l != NOT_IN_LOOP && !loopContainsNum(forest, l, s); l = forest->parent[l]){
+        exitCount[l]++;
+        total++;
+      }
+    }
+  }
+
+  /*  bucket every exit edge by loop, then drop the repeated exit node */
+  allStart  = createIndexArray(numOfLoop);
+  allExit   = createIndexArray(total);
+  allStart[0] = 0;
+  for(l = 0; l < numOfLoop; l++)
+    allStart[l + 1] = allStart[l] + exitCount[l];
+  for(l = 0; l < numOfLoop; l++)
+    exitCount[l] = allStart[l];
+  for(p = 0; p < n; p++){
+    nodePtr = forest->node[p];
+    for(i = 0; i < nodePtr->numOfChild; i++){
+      s = nodePtr->children[i]->nodeIndex[INDEX_LOOP];
+      for(l = forest->loopOf[p]; l != NOT_IN_LOOP && !loopContainsNum(forest, l, s); l = forest->parent[l])
+        allExit[exitCount[l]++] = s;
+    }
+  }
+
+  for(p = 0; p < n; p++)
+    mark[p] = NOT_IN_LOOP;
+  for(l = 0; l < numOfLoop; l++){
+    exitCount[l] = count;
+    for(k = allStart[l]; k < allStart[l + 1]; k++){
+      if(mark[allExit[k]] != l){
+        mark[allExit[k]]  = l;
+        allExit[count++]  = allExit[k];
+      }
+    }
+  }
+  exitCount[numOfLoop] = count;
+
+  forest->exitStart = exitCount;
+  forest->exit      = createIndexArray(count);
+  for(k = 0; k < count; k++)
+    forest->exit[k] = allExit[k];
+
+  destroyIndexArray(allStart, numOfLoop);
+  destroyIndexArray(allExit, total);
+  destroyIndexArray(mark, n);
+}
+
+/**
+ *  createLoopForest
+ *  Find every loop of the CFG reachable from (rootNode) and how they nest,
+ *  in O((node + edge) * a(node)). The nodes are visited from the last in
+ *  preorder to the first, every node w with a back edge collapse the
+ *  loop it head into itself: the nodes reaching the source of the back
+ *  edge backward without leaving the subtree of w. A node reached from
+ *  outside the subtree make the loop irreducible, its edge is moved to w
+ *  so the loop around w see it.
+ */
+LoopForest* createLoopForest(Node** rootNode){
+  if(rootNode == NULL || *rootNode == NULL)
+    ThrowError(ERR_NULL_NODE, "Empty Tree input detected!");
+
+  int n               = getNodeOrder(*rootNode, ORDER_RPO)->length;
+  LoopForest* forest  = memAlloc(MEM_LIST, sizeof(LoopForest));
+  int* lastNum        = createIndexArray(n);
+  int* nextChild      = createIndexArray(n);
+  int numOfEdge       = 0;
+  int *predStart, *pred, *unionOf, *headerOf, *loopNum, *pool, *inPool, *extraMark;
+  LoopKind* nodeKind;
+  ExtraPred extra;
+  Node* nodePtr;
+  int w, p, i, k, e, x, y, poolLength;
+
+  /*  the walk reach the same n node as the reverse postorder */
+  forest->numOfNode = n;
+  forest->node      = memAlloc(MEM_LIST, sizeof(Node*) * (n + 1));
+  numberNode(forest, *rootNode, lastNum, nextChild);
+  destroyIndexArray(nextChild, n);
+
+  /*  predecessor of every node by preorder number, the unreached are left out */
+  predStart = createIndexArray(n);
+  for(p = 0; p < n; p++){
+    predStart[p] = numOfEdge;
+    nodePtr = forest->node[p];
+    for(i = 0; i < nodePtr->numOfDirectDom; i++)
+      if(loopForestIndexOf(forest, nodePtr->directDom[i]) != NOT_IN_LOOP)
+        numOfEdge++;
+  }
+  predStart[n] = numOfEdge;
+  pred = createIndexArray(numOfEdge);
+  for(p = 0, k = 0; p < n; p++){
+    nodePtr = forest->node[p];
+    for(i = 0; i < nodePtr->numOfDirectDom; i++)
+      if(loopForestIndexOf(forest, nodePtr->directDom[i]) != NOT_IN_LOOP)
+        pred[k++] = nodePtr->directDom[i]->nodeIndex[INDEX_LOOP];
+  }
+
+  unionOf         = createIndexArray(n);
+  headerOf        = createIndexArray(n);
+  pool            = createIndexArray(n);
+  inPool          = createIndexArray(n);
+  extraMark       = createIndexArray(n);
+  nodeKind        = memAlloc(MEM_LIST, sizeof(LoopKind) * (n + 1));
+  loopNum         = createIndexArray(n);
+  extra.first     = createIndexArray(n);
+  extra.capacity  = numOfEdge + 1;
+  extra.length    = 0;
+  extra.pred      = createIndexArray(numOfEdge);
+  extra.next      = createIndexArray(numOfEdge);
+  for(p = 0; p < n; p++){
+    unionOf[p]      = p;
+    headerOf[p]     = NOT_IN_LOOP;
+    inPool[p]       = NOT_IN_LOOP;
+    extraMark[p]    = NOT_IN_LOOP;
+    loopNum[p]      = NOT_A_HEADER;
+    extra.first[p]  = -1;
+  }
+
+  for(w = n - 1; w >= 0; w--){
+    /*  the loop headed by w start from the source of its back edges */
+    poolLength = 0;
+    for(k = predStart[w]; k < predStart[w + 1]; k++){
+      if(pred[k] < w || pred[k] > lastNum[w])
+        continue;
+      if(pred[k] == w){
+        loopNum[w]  = 0;
+        nodeKind[w] = LOOP_SELF;
+        continue;
+      }
+      x = findHeader(unionOf, pred[k]);
+      if(inPool[x] != w){
+        inPool[x]           = w;
+        pool[poolLength++]  = x;
+      }
+    }
+    if(poolLength > 0){
+      loopNum[w]  = 0;
+      nodeKind[w] = LOOP_REDUCIBLE;
+    }
+
+    /*  walk backward from them, staying inside the subtree of w */
+    for(i = 0; i < poolLength; i++){
+      x = pool[i];
+      for(k = predStart[x], e = extra.first[x]; k < predStart[x + 1] || e >= 0; ){
+        if(k < predStart[x + 1]){
+          y = pred[k++];
+          if(x <= y && y <= lastNum[x])
+            continue;
+        }
+        else{
+          y = extra.pred[e];
+          e = extra.next[e];
+        }
+
+        y = findHeader(unionOf, y);
+        if(y < w || y > lastNum[w]){
+          nodeKind[w] = LOOP_IRREDUCIBLE;
+          if(extraMark[y] != w){
+            extraMark[y] = w;
+            addExtraPred(&extra, w, y);
+          }
+        }
+        else if(inPool[y] != w && y != w){
+          inPool[y]           = w;
+          pool[poolLength++]  = y;
+        }
+      }
+    }
+
+    for(i = 0; i < poolLength; i++){
+      headerOf[pool[i]] = w;
+      unionOf[pool[i]]  = w;
+    }
+  }
+
+  /*  number the loops by header, an outer header come first in preorder */
+  forest->numOfLoop = 0;
+  for(p = 0; p < n; p++)
+    if(loopNum[p] != NOT_A_HEADER)
+      loopNum[p] = forest->numOfLoop++;
+
+  forest->loopOf    = createIndexArray(n);
+  forest->loopDepth = createIndexArray(n);
+  forest->header    = createIndexArray(forest->numOfLoop);
+  forest->parent    = createIndexArray(forest->numOfLoop);
+  forest->kind      = memAlloc(MEM_LIST, sizeof(LoopKind) * (forest->numOfLoop + 1));
+  for(p = 0; p < n; p++){
+    forest->loopDepth[p] = headerOf[p] == NOT_IN_LOOP ? 0 : forest->loopDepth[headerOf[p]];
+    forest->loopOf[p]    = headerOf[p] == NOT_IN_LOOP ? NOT_IN_LOOP : loopNum[headerOf[p]];
+    if(loopNum[p] != NOT_A_HEADER){
+      forest->header[loopNum[p]]  = p;
+      forest->parent[loopNum[p]]  = forest->loopOf[p];
+      forest->kind[loopNum[p]]    = nodeKind[p];
+      forest->loopOf[p]           = loopNum[p];
+      forest->loopDepth[p]++;
+    }
+    forest->node[p]->loopDepth = forest->loopDepth[p];
+  }
+
+  fillLatches(forest, predStart, pred, lastNum);
+  fillExits(forest);
+
+  destroyIndexArray(lastNum, n);
+  destroyIndexArray(predStart, n);
+  destroyIndexArray(pred, numOfEdge);
+  destroyIndexArray(unionOf, n);
+  destroyIndexArray(headerOf, n);
+  destroyIndexArray(pool, n);
+  destroyIndexArray(inPool, n);
+  destroyIndexArray(extraMark, n);
+  destroyIndexArray(loopNum, n);
+  memFree(MEM_LIST, nodeKind, sizeof(LoopKind) * (n + 1));
+  destroyIndexArray(extra.first, n);
+  memFree(MEM_LIST, extra.pred, sizeof(int) * extra.capacity);
+  memFree(MEM_LIST, extra.next, sizeof(int) * extra.capacity);
+  return forest;
+}
+
+void destroyLoopForest(LoopForest* forest){
+  if(forest == NULL)
+    return;
+
+  memFree(MEM_LIST, forest->node, sizeof(Node*) * (forest->numOfNode + 1));
+  destroyIndexArray(forest->loopOf, forest->numOfNode);
+  destroyIndexArray(forest->loopDepth, forest->numOfNode);
+  destroyIndexArray(forest->header, forest->numOfLoop);
+  destroyIndexArray(forest->parent, forest->numOfLoop);
+  memFree(MEM_LIST, forest->kind, sizeof(LoopKind) * (forest->numOfLoop + 1));
+  destroyIndexArray(forest->latch, forest->latchStart[forest->numOfLoop]);
+  destroyIndexArray(forest->latchStart, forest->numOfLoop);
+  destroyIndexArray(forest->exit, forest->exitStart[forest->numOfLoop]);
+  destroyIndexArray(forest->exitStart, forest->numOfLoop);
+  memFree(MEM_LIST, forest, sizeof(LoopForest));
+}
+
+/**
+ *  loopForestIndexOf
+ *  return the preorder number of (node), NOT_IN_LOOP when the node
+ *  cannot be reached from the root
+ */
+int loopForestIndexOf(LoopForest* forest, Node* node){
+  int p;
+
+  if(forest == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: LoopForest cannot be NULL!");
+
+  if(node == NULL)
+    return NOT_IN_LOOP;
+
+  p = node->nodeIndex[INDEX_LOOP];
+  if(p < 0 || p >= forest->numOfNode || forest->node[p] != node)
+    return NOT_IN_LOOP;
+  return p;
+}
+
+/**
+ *  getLoopOf
+ *  return the innermost loop holding (node), NOT_IN_LOOP when there is none
+ */
+int getLoopOf(LoopForest* forest, Node* node){
+  int p = loopForestIndexOf(forest, node);
+
+  return p == NOT_IN_LOOP ? NOT_IN_LOOP : forest->loopOf[p];
+}
+
+/**
+ *  loopContains
+ *  return 1 when (node) is inside (loop) or a loop nested in it
+ */
+int loopContains(LoopForest* forest, int loop, Node* node){
+  int p = loopForestIndexOf(forest, node);
+
+  if(p == NOT_IN_LOOP || loop < 0 || loop >= forest->numOfLoop)
+    return 0;
+
+  return loopContainsNum(forest, loop, p);
+}
+
+int isLoopHeader(LoopForest* forest, Node* node){
+  int l = getLoopOf(forest, node);
+
+  return l != NOT_IN_LOOP && forest->node[forest->header[l]] == node;
+}
@@ -0,0 +1,81 @@
+#ifndef LoopForest_H
+#define LoopForest_H
+
+#include "ErrorObject.h"
+#include "BitSet.h"
+#include "NodeChain.h"
+
+#define NOT_IN_LOOP  -1
+
+typedef enum{
+  LOOP_SELF,          // a single node with an edge to itself
+  LOOP_REDUCIBLE,     // entered through the header only
+  LOOP_IRREDUCIBLE    // also entered by an edge that skip the header
+}LoopKind;
+
+/**
+ * LoopForest
+ *
+ *  Object of LoopForest's type is the loop nesting forest of a CFG, found
+ *  by the algorithm of Havlak. The nodes are numbered in preorder of a
+ *  depth first walk from the root, a loop is named by its header, the
+ *  node of the loop that come first in the walk. An irreducible region
+ *  is a single loop with the header it was first entered through.
+ *
+ *  LoopForest contain:
+ *    1. numOfNode    number of node reachable from the root
+ *    2. node         node[p] is the node with preorder number p
+ *    3. loopOf       innermost loop of p, NOT_IN_LOOP when p is in none
+ *    4. loopDepth    number of loop p is in, 0 outside every loop
+ *    5. numOfLoop    number of loop, an outer loop come before the loops
+ *                    inside it
+ *    6. header       header[l] is the preorder number of the header of l
+ *    7. parent       the loop l is directly inside, NOT_IN_LOOP for an
+ *                    outermost loop
+ *    8. kind         LOOP_SELF / LOOP_REDUCIBLE / LOOP_IRREDUCIBLE
+ *    9. latchStart   the latches of l, the nodes with a back edge to the
+ *   10. latch          header, are latch[latchStart[l]] .. latch[latchStart[l + 1] - 1]
+ *   11. exitStart    the exits of l, the nodes outside l reached by an
+ *   12. exit           edge from inside, are exit[exitStart[l]] .. exit[exitStart[l + 1] - 1]
+ *
+ *          A            p  node  loopOf  loopDepth     l  header  parent  latch  exit
+ *          |            0   A      -        0          0    B       -      D      E
+ *  +-----> B            1   B      0        1          1    C       0      D      B
+ *  |      / \           2   C      1        2
+ *  | +-> C   E          3   D      1        2
+ *  | |   |              4   E      -        0
+ *  +-+-- D
+ *
+ *  The preorder number of a node is kept in its nodeIndex of INDEX_LOOP,
+ *  loopForestIndexOf give it back.
+ *
+ *  createLoopForest also write the loopDepth of every reachable node into
+ *  Node.loopDepth, so a pass can weight a block without the forest.
+ *
+ *  The LoopForest does not follow a later change of the edges, build it
+ *  again after changing the CFG.
+ */
+typedef struct{
+  int numOfNode;
+  Node** node;
+  int* loopOf;
+  int* loopDepth;
+  int numOfLoop;
+  int* header;
+  int* parent;
+  LoopKind* kind;
+  int* latchStart;
+  int* latch;
+  int* exitStart;
+  int* exit;
+}LoopForest;
+
+LoopForest* createLoopForest(Node** rootNode);
+void destroyLoopForest(LoopForest* forest);
+
+int loopForestIndexOf(LoopForest* forest, Node* node);
+int getLoopOf(LoopForest* forest, Node* node);
+int loopContains(LoopForest* forest, int loop, Node* node);
+int isLoopHeader(LoopForest* forest, Node* node);
+
+#endif // LoopForest_H
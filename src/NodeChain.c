@@ -1,24 +1,181 @@
 #include "NodeChain.h"
+#include "Allocator.h"
+#include "BitSet.h"
+#include "LcaIndex.h"
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
+
+#define NODE_STACK_CAPACITY  64
+
+static int numOfNode = 0;
+static int visitEpoch[NUM_OF_VISIT];
+static int edgeClock = 0;
+
+/*
+ *  FrontierPair
+ *  (frontier) belong to the domFrontiers of (node), getAllDomFrontiers
+ *  chain the pairs found through the same edge with (next)
+ */
+typedef struct{
+  Node* node;
+  Node* frontier;
+  int next;
+}FrontierPair;
+
+static void collectDomFrontiers(Node* node, Vector* domFrontiers, Vector* checklist);
+
+/**
+ *  getNumOfNode
+ *  Number of node created so far, the id of every node is smaller than it.
+ *  It count the nodes of every CFG, size the scratch of a pass by the
+ *  nodes it number (numberNodes) instead.
+ */
+int getNumOfNode(void){
+  return numOfNode;
+}
+
+/**
+ *  startVisit
+ *  Begin a new traversal of (kind), every node become not visited
+ */
+void startVisit(VisitKind kind){
+  visitEpoch[kind]++;
+}
+
+void markVisited(Node* node, VisitKind kind){
+  node->visitMark[kind] = visitEpoch[kind];
+}
+
+int isVisited(Node* node, VisitKind kind){
+  return node->visitMark[kind] == visitEpoch[kind];
+}
+
+/**
+ *  numberNodes
+ *  Give every node of (nodeList) its place in it as number of (kind)
+ */
+void numberNodes(Vector* nodeList, IndexKind kind){
+  int k;
+
+  for(k = 0; k < nodeList->length; k++)
+    ((Node*)nodeList->item[k])->nodeIndex[kind] = k;
+}
+
+/**
+ *  addNumberedNode
+ *  Put (node) at the end of (nodeList) and number it with (kind), a node
+ *  already in nodeList keep its place. return the number of the node
+ */
+int addNumberedNode(Vector* nodeList, Node* node, IndexKind kind){
+  int index = getNodeIndex(nodeList, node, kind);
+
+  if(index != NOT_NUMBERED)
+    return index;
+  node->nodeIndex[kind] = nodeList->length;
+  vectorAddLast(nodeList, node);
+  return node->nodeIndex[kind];
+}
+
+/**
+ *  getNodeIndex
+ *  return the place of (node) inside (nodeList) numbered with (kind),
+ *  NOT_NUMBERED when the node is not there
+ */
+int getNodeIndex(Vector* nodeList, Node* node, IndexKind kind){
+  int index = node->nodeIndex[kind];
+
+  if(index < 0 || index >= nodeList->length || nodeList->item[index] != node)
+    return NOT_NUMBERED;
+  return index;
+}
 
 Node* createNode(int thisRank){
-  Node* newNode = malloc(sizeof(Node));
-
-  newNode->rank         = thisRank;
-  newNode->visitFlag    = 0;
-  newNode->block        = createLinkedList();
-  newNode->parent       = NULL;
-  newNode->lastBrhDom   = NULL;
-  newNode->imdDom       = NULL;
-  newNode->numOfChild   = 0;
-  newNode->children     = NULL;
-  newNode->domFrontiers = NULL;
-  newNode->directDom    = createLinkedList();
+  Node* newNode = memAlloc(MEM_NODE, sizeof(Node));
+  int kind;
+
+  newNode->id                = numOfNode++;
+  newNode->rank              = thisRank;
+  newNode->loopDepth         = 0;
+  for(kind = 0; kind < NUM_OF_VISIT; kind++)
+    newNode->visitMark[kind] = visitEpoch[kind] - 1;
+  for(kind = 0; kind < NUM_OF_INDEX; kind++)
+    newNode->nodeIndex[kind] = NOT_NUMBERED;
+  newNode->block             = createLinkedList();
+  newNode->parent            = NULL;
+  newNode->lastBrhDom        = NULL;
+  newNode->imdDom            = NULL;
+  newNode->numOfChild        = 0;
+  newNode->childCapacity     = NODE_INLINE_EDGE;
+  newNode->children          = newNode->inlineChild;
+  newNode->domFrontiers      = NULL;
+  newNode->numOfDirectDom    = 0;
+  newNode->directDomCapacity = NODE_INLINE_EDGE;
+  newNode->directDom         = newNode->inlineDirectDom;
+  newNode->orderStamp        = 0;
+  newNode->orderAllocator    = MALLOC_VERSION;
+  newNode->edgeStamp         = 0;
+  for(kind = 0; kind < NUM_OF_ORDER; kind++)
+    newNode->order[kind] = NULL;
 
   return newNode;
 }
 
+/**
+ *  addEdge
+ *  Put (node) at the end of an edge array of a Node. The array start as
+ *  the inline array of the Node and is only moved to the heap when it
+ *  run out of inline space.
+ *
+ *  return the edge array, which may have been moved
+ */
+static Node** addEdge(Node** edge, int* numOfEdge, int* capacity, Node** inlineEdge, Node* node){
+  int newCapacity;
+
+  if(*numOfEdge == *capacity){
+    newCapacity = *capacity * 2;
+    if(edge == inlineEdge){
+      edge = memAlloc(MEM_NODE, sizeof(Node*) * newCapacity);
+      memcpy(edge, inlineEdge, sizeof(Node*) * (*numOfEdge));
+    }
+    else
+      edge = memRealloc(MEM_NODE, edge, sizeof(Node*) * (*capacity), sizeof(Node*) * newCapacity);
+    *capacity = newCapacity;
+  }
+
+  edge[(*numOfEdge)++] = node;
+  return edge;
+}
+
+static void freeEdge(Node** edge, int capacity, Node** inlineEdge){
+  if(edge != inlineEdge)
+    memFree(MEM_NODE, edge, sizeof(Node*) * capacity);
+}
+
+/**
+ *  removeEdge
+ *  Take the first (node) out of an edge array, the edges behind it move
+ *  forward so the order is kept.
+ *
+ *  return the position (node) was at, -1 when it is not in the array
+ */
+static int removeEdge(Node** edge, int* numOfEdge, Node* node){
+  int i, position;
+
+  for(position = 0; position < *numOfEdge; position++)
+    if(edge[position] == node)
+      break;
+
+  if(position == *numOfEdge)
+    return -1;
+
+  for(i = position + 1; i < *numOfEdge; i++)
+    edge[i - 1] = edge[i];
+  (*numOfEdge)--;
+
+  return position;
+}
+
 
 /*
  * brief @ Add a new child to a node as shown below.
@@ -47,98 +204,231 @@ void addChild(Node** parentNode, Node** childNode){
   /***************************************************
   *  Link Child to parentNode                       *
   ***************************************************/
-  (*parentNode)->numOfChild++;
-  (*parentNode)->children = (Node**)realloc((*parentNode)->children, \
-                            (sizeof(Node*) * ((*parentNode)->numOfChild)));
-
-  (*parentNode)->children[((*parentNode)->numOfChild) - 1] = *childNode;
+  (*parentNode)->children = addEdge((*parentNode)->children, &(*parentNode)->numOfChild, \
+                                    &(*parentNode)->childCapacity, (*parentNode)->inlineChild, *childNode);
 
   /***************************************************
   *  Link Parent to childNode                       *
   ***************************************************/
   (*childNode)->parent = *parentNode;
+  addDirectDom(childNode, parentNode);
+  invalidateNodeOrder(*parentNode);
+
+}
+
+/*
+ * brief @ Remove the edge from parentNode to childNode, the reverse of addChild.
+ *
+ * brief @ The other children of parentNode and the other directDom of childNode keep their order.
+ * brief @ When parentNode was the parent of childNode, the parent become the last directDom
+ *         left (NULL when there is none).
+ *
+ * param @ parentNode - The node that own the edge.
+ * param @ childNode  - The node the edge point to.
+ * retval@ void  - Nothing to return.
+ */
+void removeChild(Node** parentNode, Node** childNode){
+  if(*parentNode == NULL)
+    ThrowError(ERR_NULL_NODE, "Input parent node is NULL!");
+
+  if(*childNode == NULL)
+    ThrowError(ERR_NULL_NODE, "Input child node is NULL!");
+
+  Node* parentPtr = *parentNode;
+  Node* childPtr  = *childNode;
+
+  if(removeEdge(parentPtr->children, &parentPtr->numOfChild, childPtr) < 0)
+    ThrowError(ERR_NO_EDGE, "Node %d is not a child of node %d", childPtr->id, parentPtr->id);
+
+  removeEdge(childPtr->directDom, &childPtr->numOfDirectDom, parentPtr);
+  invalidateNodeOrder(parentPtr);
 
+  if(childPtr->parent == parentPtr)
+    childPtr->parent = childPtr->numOfDirectDom ? childPtr->directDom[childPtr->numOfDirectDom - 1] : NULL;
+}
+
+/*
+ *  lastBrhDomSlot
+ *  Slot of the lastBrhDom of (node) inside (lcaIndex), LCA_NO_PARENT for
+ *  the root or when the lastBrhDom is not there or does not come before
+ *  the node in rank
+ */
+static int lastBrhDomSlot(LcaIndex* lcaIndex, Vector* slotList, Node* node){
+  Node* lastBrhDom = node->lastBrhDom;
+  int slot;
+
+  if(node->parent == NULL || lastBrhDom == NULL || lastBrhDom->rank >= node->rank)
+    return LCA_NO_PARENT;
+  slot = getNodeIndex(slotList, lastBrhDom, INDEX_ORDER);
+  if(slot == NOT_NUMBERED || !lcaIndexHas(lcaIndex, slot))
+    return LCA_NO_PARENT;
+
+  return slot;
+}
+
+/*
+ *  findSameNode
+ *  Meet of the lastBrhDom chain of (testRankNode_1) and (testRankNode_2).
+ *  The LcaIndex answer in O(log n) while it still follow the lastBrhDom,
+ *  otherwise the chain are walked with FIND_SAME_NODE.
+ */
+static Node* findSameNode(Vector* nodeList, LcaIndex* lcaIndex, int isIndexValid, \
+                          Node* testRankNode_1, Node* testRankNode_2){
+  int slot = LCA_NO_PARENT;
+
+  if(isIndexValid && testRankNode_1 != NULL && testRankNode_2 != NULL && \
+     getNodeIndex(nodeList, testRankNode_1, INDEX_ORDER) != NOT_NUMBERED && \
+     getNodeIndex(nodeList, testRankNode_2, INDEX_ORDER) != NOT_NUMBERED)
+    slot = lcaIndexFind(lcaIndex, testRankNode_1->nodeIndex[INDEX_ORDER], testRankNode_2->nodeIndex[INDEX_ORDER]);
+  if(slot != LCA_NO_PARENT)
+    return nodeList->item[slot];
+
+  FIND_SAME_NODE(testRankNode_1, testRankNode_2);
+  return testRankNode_1;
 }
 
 void setLastBrhDom(Node** rootNode){
   if(*rootNode == NULL)
     ThrowError(ERR_NULL_NODE, "Empty Tree input detected!");
 
-  LinkedList* tempList      = assembleList(rootNode);
-  ListElement* tempElement  = tempList->head;
-  Node* tempNode            = tempElement->node;
-  int i, k;
-  Node *highRankNode, *testRankNode_1, *testRankNode_2;
+  Vector* tempList          = getNodeOrder(*rootNode, ORDER_RANK);
+  Vector* slotList          = createVector(0);
+  Node *tempNode, *childNode;
+  int i, k, slot, isIndexValid = 1;
+  Node *testRankNode_1, *testRankNode_2;
+
+  //the position of a node in slotList is its slot in the LcaIndex
+  for(k = 0; k < tempList->length; k++)
+    addNumberedNode(slotList, tempList->item[k], INDEX_ORDER);
+  LcaIndex* lcaIndex        = createLcaIndex(slotList->length);
 
 /****************************************************
  *  With the LinkedList, find and assign lastBrhDom *
  *  of each node in the Node tree                   *
  ****************************************************/
-  while(tempElement != NULL){
-    tempNode = tempElement->node;
+  for(k = 0; k < tempList->length; k++){
+    tempNode = tempList->item[k];
+    //the lastBrhDom of the node is final once every parent before it is done
+    slot     = tempNode->nodeIndex[INDEX_ORDER];
+    if(!lcaIndexHas(lcaIndex, slot))
+      lcaIndexPut(lcaIndex, slot, lastBrhDomSlot(lcaIndex, slotList, tempNode));
+
     for(i = 0; i < tempNode->numOfChild; i++){
+      childNode = tempNode->children[i];
+
       //handle ROOT Node
       if(tempNode->parent == NULL){
         tempNode->lastBrhDom = NULL;
       }//handle child with 1 parent only (no assign to lastBrhDom yet)
-      if(tempNode->children[i]->lastBrhDom == NULL){
+      if(childNode->lastBrhDom == NULL){
         if(tempNode->numOfChild > 1 || tempNode->parent == NULL)
-          tempNode->children[i]->lastBrhDom = tempNode;
+          childNode->lastBrhDom = tempNode;
         else if(tempNode->lastBrhDom != NULL)
-          tempNode->children[i]->lastBrhDom = tempNode->lastBrhDom;
+          childNode->lastBrhDom = tempNode->lastBrhDom;
       }//handle child with more than 1 parent (lastBrhDom assigned by prev parents)
       else{
         testRankNode_1 = tempNode->lastBrhDom;
-        testRankNode_2 = tempNode->children[i]->lastBrhDom;
-        FIND_SAME_NODE(testRankNode_1, testRankNode_2);
-        tempNode->children[i]->lastBrhDom = testRankNode_1;
+        testRankNode_2 = childNode->lastBrhDom;
+        childNode->lastBrhDom = findSameNode(slotList, lcaIndex, isIndexValid, testRankNode_1, testRankNode_2);
       }
+
+      //a back edge moved the lastBrhDom of a node already in the LcaIndex
+      slot = getNodeIndex(slotList, childNode, INDEX_ORDER);
+      if(slot != NOT_NUMBERED && lcaIndexHas(lcaIndex, slot) && \
+         lcaIndex->up[slot] != lastBrhDomSlot(lcaIndex, slotList, childNode))
+        isIndexValid = 0;
     }
-    tempElement = tempElement->next;
   }
+  destroyVector(slotList);
+  destroyLcaIndex(lcaIndex);
 }
 
-void getImdDom(Node* nodeA){
-  if(nodeA->rank == 0)
-    nodeA->imdDom = NULL;
-  else{
-    int i;
-    Node *boudariesNode       = nodeA->lastBrhDom;
-    LinkedList* tempList      = assembleList(&boudariesNode);
-    ListElement* tempElement  = tempList->head;
-    Node *tempNode;
-    /*************************************************
-    * Find the imdDominator and return it           *
-    *************************************************/
-    while(tempElement != NULL){
-      tempNode = tempElement->node;
-      for(i = 0; i < tempNode->numOfChild; i++){
-        if(tempNode->children[i] == nodeA){
-          if(nodeA->imdDom == NULL)
-            nodeA->imdDom = tempNode;
-          else{
-            if(tempNode != nodeA)
-              nodeA->imdDom = nodeA->lastBrhDom;
-          }
-        }
-      }
-      tempElement = tempElement->next;
+/*
+ *  upperDom
+ *  Next node up the dominator of (node): its imdDom once found, its
+ *  lastBrhDom before that. A rank 0 node is the top, a back edge may
+ *  have given it a lastBrhDom.
+ */
+static Node* upperDom(Node* node){
+  if(node->rank == 0)
+    return NULL;
+  return node->imdDom != NULL ? node->imdDom : node->lastBrhDom;
+}
+
+/*
+ *  findImdDom
+ *  The imdDom of (nodeA) is the lowest node found on the upperDom chain
+ *  of every one of its directDom. (chain) hold the chain of the meet so
+ *  far from chain->item[start] up, numbered with INDEX_ORDER, and each
+ *  other directDom only walk until it reach it. A directDom whose chain
+ *  go through nodeA is reached through a back edge, one whose chain does
+ *  not end at a rank 0 node is not reached at all, both are left out.
+ */
+static Node* findImdDom(Node* nodeA, Vector* chain){
+  Node *domPtr, *nodePtr;
+  int i, index, start = 0;
+
+  chain->length = 0;
+  for(i = 0; i < nodeA->numOfDirectDom; i++){
+    domPtr = nodeA->directDom[i];
+    if(chain->length == 0){
+      for(nodePtr = domPtr; nodePtr != NULL && nodePtr != nodeA; nodePtr = upperDom(nodePtr))
+        if(addNumberedNode(chain, nodePtr, INDEX_ORDER) != chain->length - 1)
+          break;
+      if(nodePtr != NULL || ((Node*)VECTOR_LAST(chain))->rank != 0)
+        chain->length = 0;
+      continue;
     }
+
+    index = NOT_NUMBERED;
+    for(nodePtr = domPtr; nodePtr != NULL && nodePtr != nodeA; nodePtr = upperDom(nodePtr)){
+      index = getNodeIndex(chain, nodePtr, INDEX_ORDER);
+      if(index != NOT_NUMBERED)
+        break;
+    }
+    if(index != NOT_NUMBERED && index > start)
+      start = index;
   }
+
+  return chain->length ? chain->item[start] : NULL;
 }
 
+/**
+ *  getImdDom
+ *  Set the imdDom of (nodeA) from its directDom alone, every directDom
+ *  only walk up its own imdDom (lastBrhDom when not found yet) until the
+ *  chain of the others, so nothing below them is visited. The imdDom of
+ *  the directDom should be set first or setLastBrhDom be called.
+ */
+void getImdDom(Node* nodeA){
+  Vector* chain = createVector(0);
+
+  nodeA->imdDom = nodeA->rank == 0 ? NULL : findImdDom(nodeA, chain);
+  destroyVector(chain);
+}
+
+/**
+ *  setAllImdDom
+ *  Set every imdDom in one pass over the rank order. A node is put again
+ *  in that order after each directDom before it in rank, so the last time
+ *  it is met every such directDom already has its imdDom.
+ */
 void setAllImdDom(Node** rootNode){
-  LinkedList* tempList      = assembleList(rootNode);
-  ListElement* tempElement  = tempList->head;
-  Node *tempNode;
-  /*************************************************
-  * Find the imdDominator and return it           *
-  *************************************************/
-  while(tempElement != NULL){
-    tempNode = tempElement->node;
-    getImdDom(tempNode);
-    tempElement = tempElement->next;
+  if(*rootNode == NULL)
+    ThrowError(ERR_NULL_NODE, "Empty Tree input detected!");
+
+  Vector* tempList          = getNodeOrder(*rootNode, ORDER_RANK);
+  Vector* chain             = createVector(0);
+  Node* tempNode;
+  int k;
+
+  for(k = 0; k < tempList->length; k++)
+    ((Node*)tempList->item[k])->imdDom = NULL;
+  for(k = 0; k < tempList->length; k++){
+    tempNode          = tempList->item[k];
+    tempNode->imdDom  = tempNode->rank == 0 ? NULL : findImdDom(tempNode, chain);
   }
+  destroyVector(chain);
 }
 
 
@@ -164,28 +454,42 @@ void setAllImdDom(Node** rootNode){
  *
  * param @ Node* node  - The node that is going to use this function to find the domFrontiers of it.
  *
- * retval@ LinkedList* - The list of domFrontiers of the 'Node* node' is going to return.
+ * retval@ Vector* - The list of domFrontiers of the 'Node* node' is going to return.
  */
-LinkedList* getNodeDomFrontiers(Node* node){
+Vector* getNodeDomFrontiers(Node* node){
 
-  LinkedList* domFrontiers = createLinkedList();
-  LinkedList* checklist = createLinkedList();
-  ListElement* tempCLElement = NULL;
-  ListElement* tempHeadCL = NULL;
-  Node *tempImdDom = NULL;
-  int i = 0;
+  Vector* domFrontiers = createVector(0);
 
   if(!node->numOfChild)
     return domFrontiers;
 
-  addListLast(checklist, node);
-  tempHeadCL = checklist->head;
+  Vector* checklist     = createVector(0);
+
+  collectDomFrontiers(node, domFrontiers, checklist);
+
+  destroyVector(checklist);
+  return domFrontiers;
+}
+
+/*
+ *  collectDomFrontiers
+ *  Body of getNodeDomFrontiers, (checklist) is only scratch space and is
+ *  emptied first. A node is put into it once, numbered by its place.
+ */
+static void collectDomFrontiers(Node* node, Vector* domFrontiers, Vector* checklist){
+  Node *tempHeadCL = NULL;
+  Node *tempImdDom = NULL;
+  int i = 0, k;
+
+  checklist->length = 0;
+  addNumberedNode(checklist, node, INDEX_ORDER);
 
-  while(tempHeadCL){
+  for(k = 0; k < checklist->length; k++){
+    tempHeadCL = checklist->item[k];
 
-    for( i = 0; i < ((Node*)tempHeadCL->node)->numOfChild; i++){
+    for( i = 0; i < tempHeadCL->numOfChild; i++){
 
-      tempImdDom = ((Node*)tempHeadCL->node)->children[i]->imdDom;
+      tempImdDom = tempHeadCL->children[i]->imdDom;
 
       //checking the imdDom of the child isn't the parentNode; imdDom of the parentNode is NULL
       if(tempImdDom){
@@ -196,34 +500,21 @@ LinkedList* getNodeDomFrontiers(Node* node){
 
       //the child is not strictly dominated by the node
       if(tempImdDom != node || !tempImdDom){
-        addListLast(domFrontiers, ((Node*)tempHeadCL->node)->children[i]);
+        vectorAddLast(domFrontiers, tempHeadCL->children[i]);
         continue; //any grandchild need to be dominated by node, otherwise the child of grandchild cannot be DF of node
       }
 
-      tempCLElement = checklist->head;
-
-      //checking is the children already put in the checklist
-      while(tempCLElement){
-
-        if( ((Node*)tempHeadCL->node)->children[i] == tempCLElement->node )
-          break;
-
-        tempCLElement = tempCLElement->next;
-      }
-
-     if(!tempCLElement)
-        addListLast(checklist, ((Node*)tempHeadCL->node)->children[i]);
+      //the children is put in the checklist once
+      addNumberedNode(checklist, tempHeadCL->children[i], INDEX_ORDER);
     }
-
-    tempHeadCL = tempHeadCL->next;
-
   }
-
-  return domFrontiers;
 }
 
 /**
- * brief @ To get all the dominatorFrontiers of a tree by using the getNodeDomFrontiers() function.
+ * brief @ To get all the dominatorFrontiers of a tree at once, every node is put into the
+ *         domFrontiers of the nodes between its predecessor and its imdDom (Cooper, Harvey
+ *         and Kennedy). The walk stop at a node that already has it, so the time taken is
+ *         linear to the number of edge and the size of all the domFrontiers together.
  * Example:
  *        ControlFlowGraph1         Union of DomFrontiers
  *
@@ -237,97 +528,430 @@ LinkedList* getNodeDomFrontiers(Node* node){
  *           \/   \/    /\
  *             [D] >>>>>>>
  *
+ *         The edges are walked in the order of assembleList, so the domFrontiers of each
+ *         node come in the same order as getNodeDomFrontiers give them.
+ *
  * param @ Node* node  - The tree that is going to use this function to find all the domFrontiers of it.
  *
- * retval@ LinkedList* - The union of domFrontiers of the input argument, 'Node** root' is going to return.
+ * retval@ Vector* - The union of domFrontiers of the input argument, 'Node** root' is going to return.
  **/
-LinkedList* getAllDomFrontiers(Node** root){
-
-  LinkedList* domFrontiers = createLinkedList();
-  LinkedList* checklist = assembleList(root);
-  ListElement* tempCheckList = NULL;
-  ListElement* tempDFList = NULL;
-  ListElement* tempCLElement = NULL;
-  ListElement* tempHeadDF = NULL;
-  int i;
-
-  tempCheckList = checklist->head;
-
-  //get domFs of each node and add in the list, compare between DFlist and nodeDFlist, if already inside DFlist, just skip
-  while(tempCheckList){
-    ((Node*)tempCheckList->node)->domFrontiers = getNodeDomFrontiers(tempCheckList->node);
-    tempHeadDF = ((Node*)tempCheckList->node)->domFrontiers->head;
-
-    while(tempHeadDF){
-
-      tempDFList = domFrontiers->head;
-      while(tempDFList){
+Vector* getAllDomFrontiers(Node** root){
+
+  Vector* domFrontiers    = createVector(0);
+  Vector* nodeOrder       = getNodeOrder(*root, ORDER_RANK);
+  Vector* checklist       = createVector(nodeOrder->length);
+  BitSet* domFrontierSet;
+  int numOfChecked, numOfNumbered;
+  int numOfEdge           = 0, numOfPair = 0, pairCapacity;
+  int *inStart, *lastFrontier, *edgeOf, *headOfEdge;
+  Node **inPred, **inChild;
+  FrontierPair* pair;
+  Node *tempNode = NULL, *frontierNode, *runner;
+  int i, k, index;
+
+  //drop the node assembleList gave twice and clear the old domFrontiers
+  for(k = 0; k < nodeOrder->length; k++){
+    tempNode = nodeOrder->item[k];
+    if(getNodeIndex(checklist, tempNode, INDEX_ORDER) != NOT_NUMBERED)
+      continue;
+    addNumberedNode(checklist, tempNode, INDEX_ORDER);
+    numOfEdge += tempNode->numOfChild;
+    destroyVector(tempNode->domFrontiers);
+    tempNode->domFrontiers = createVector(0);
+  }
 
-          if(tempDFList->node == tempHeadDF->node )
-            break;
+  //a child left out by assembleList is numbered after them, its domFrontiers stay as they are
+  numOfChecked = checklist->length;
+  for(k = 0; k < numOfChecked; k++){
+    tempNode = checklist->item[k];
+    for(i = 0; i < tempNode->numOfChild; i++)
+      addNumberedNode(checklist, tempNode->children[i], INDEX_ORDER);
+  }
+  numOfNumbered   = checklist->length;
+  domFrontierSet  = createBitSet(numOfNumbered);
+  inStart         = memAlloc(MEM_LIST, sizeof(int) * (numOfNumbered + 1));
+  lastFrontier    = memAlloc(MEM_LIST, sizeof(int) * (numOfNumbered + 1));
+
+  //bucket every edge by its child, in the order of checklist
+  memset(inStart, 0, sizeof(int) * (numOfNumbered + 1));
+  for(k = 0; k < numOfChecked; k++){
+    tempNode = checklist->item[k];
+    for(i = 0; i < tempNode->numOfChild; i++)
+      inStart[tempNode->children[i]->nodeIndex[INDEX_ORDER] + 1]++;
+  }
+  for(i = 0; i < numOfNumbered; i++){
+    inStart[i + 1] += inStart[i];
+    lastFrontier[i] = inStart[i];
+  }
 
-          tempDFList = tempDFList->next;
-        }
+  inPred  = memAlloc(MEM_LIST, sizeof(Node*) * (numOfEdge + 1));
+  inChild = memAlloc(MEM_LIST, sizeof(Node*) * (numOfEdge + 1));
+  edgeOf  = memAlloc(MEM_LIST, sizeof(int) * (numOfEdge + 1));
+  for(k = 0, numOfEdge = 0; k < numOfChecked; k++){
+    tempNode = checklist->item[k];
+    for(i = 0; i < tempNode->numOfChild; i++, numOfEdge++){
+      frontierNode = tempNode->children[i];
+      index        = frontierNode->nodeIndex[INDEX_ORDER];
+      inPred[lastFrontier[index]]   = tempNode;
+      inChild[lastFrontier[index]]  = frontierNode;
+      edgeOf[lastFrontier[index]++] = numOfEdge;
+    }
+  }
 
-      if(!tempDFList)
-        addListLast(domFrontiers, tempHeadDF->node);
+  //walk up from every predecessor of a node until its imdDom, the edges of one node come together
+  pairCapacity  = numOfEdge + 1;
+  pair          = memAlloc(MEM_LIST, sizeof(FrontierPair) * pairCapacity);
+  headOfEdge    = memAlloc(MEM_LIST, sizeof(int) * (numOfEdge + 1));
+  for(i = 0; i < numOfNumbered; i++)
+    lastFrontier[i] = -1;
+  for(i = 0; i < numOfEdge; i++)
+    headOfEdge[i] = -1;
+
+  for(k = 0; k < numOfEdge; k++){
+    frontierNode = inChild[k];
+    for(runner = inPred[k]; runner && runner != frontierNode->imdDom; runner = runner->imdDom){
+      index = getNodeIndex(checklist, runner, INDEX_ORDER);
+      if(index == NOT_NUMBERED || index >= numOfChecked || \
+         lastFrontier[index] == frontierNode->nodeIndex[INDEX_ORDER])
+        break;
+      lastFrontier[index] = frontierNode->nodeIndex[INDEX_ORDER];
 
-      tempHeadDF = tempHeadDF->next;
+      if(numOfPair == pairCapacity){
+        pair = memRealloc(MEM_LIST, pair, sizeof(FrontierPair) * pairCapacity, \
+                          sizeof(FrontierPair) * pairCapacity * 2);
+        pairCapacity *= 2;
+      }
+      pair[numOfPair].node      = runner;
+      pair[numOfPair].frontier  = frontierNode;
+      pair[numOfPair].next      = headOfEdge[edgeOf[k]];
+      headOfEdge[edgeOf[k]]     = numOfPair++;
     }
+  }
 
-    tempCheckList = tempCheckList->next;
+  //hand the pairs out in the order of their edge
+  for(i = 0; i < numOfEdge; i++)
+    for(k = headOfEdge[i]; k != -1; k = pair[k].next)
+      vectorAddLast(pair[k].node->domFrontiers, pair[k].frontier);
+
+  //union of the domFrontiers of each node, in the order of checklist
+  for(k = 0; k < numOfChecked; k++){
+    tempNode = checklist->item[k];
+    for(i = 0; i < tempNode->domFrontiers->length; i++){
+      frontierNode = tempNode->domFrontiers->item[i];
+      if(!bitSetHas(domFrontierSet, frontierNode->nodeIndex[INDEX_ORDER])){
+        bitSetAdd(domFrontierSet, frontierNode->nodeIndex[INDEX_ORDER]);
+        vectorAddLast(domFrontiers, frontierNode);
+      }
+    }
   }
 
+  memFree(MEM_LIST, inStart, sizeof(int) * (numOfNumbered + 1));
+  memFree(MEM_LIST, lastFrontier, sizeof(int) * (numOfNumbered + 1));
+  memFree(MEM_LIST, inPred, sizeof(Node*) * (numOfEdge + 1));
+  memFree(MEM_LIST, inChild, sizeof(Node*) * (numOfEdge + 1));
+  memFree(MEM_LIST, edgeOf, sizeof(int) * (numOfEdge + 1));
+  memFree(MEM_LIST, pair, sizeof(FrontierPair) * pairCapacity);
+  memFree(MEM_LIST, headOfEdge, sizeof(int) * (numOfEdge + 1));
+  destroyVector(checklist);
+  destroyBitSet(domFrontierSet);
+
   return domFrontiers;
 
 }
 
 //ASSEMBLE ALL THE NODE THAT HAVE A RANK EQUAL OR LOWER THAN THE ROOT INTO A LINKEDLIST
-LinkedList* assembleList(Node **rootNode){
-    LinkedList* tempList      = createLinkedList();
-    addListLast(tempList, *rootNode);
-    int i;
-    ListElement* tempElement  = tempList->head;
-    Node *tempNode            = tempElement->node;
-
-    while(tempElement != NULL){
+Vector* assembleList(Node **rootNode){
+    Vector* tempList          = createVector(0);
+    vectorAddLast(tempList, *rootNode);
+    int i, k;
+    Node *tempNode;
+
+    for(k = 0; k < tempList->length; k++){
+      tempNode = tempList->item[k];
       for(i = 0; i < tempNode->numOfChild; i++){
-        if(tempList->tail->node != tempNode->children[i] \
+        if(VECTOR_LAST(tempList) != tempNode->children[i] \
         && tempNode->rank < tempNode->children[i]->rank)
-          addListLast(tempList, tempNode->children[i]);
+          vectorAddLast(tempList, tempNode->children[i]);
       }
-      tempElement = tempElement->next;
-
-      if(tempElement != NULL)
-        tempNode = tempElement->node;
     }
     return tempList;
 }
 
-//This function assign directDominator to the node
-void setAllDirectDom(Node** rootNode){
-  (*rootNode)->visitFlag |= 8;
-  Node *childPtr;
+/**
+ *  getReversePostorder
+ *  Return every node that can be reached from (rootNode) in reverse
+ *  postorder of a depth first walk, the root come first and a node come
+ *  before all its successors except along a back edge. The walk use its
+ *  own stack so a deep CFG does not run out of C stack.
+ */
+Vector* getReversePostorder(Node** rootNode){
+  if(rootNode == NULL || *rootNode == NULL)
+    ThrowError(ERR_NULL_NODE, "Empty Tree input detected!");
+
+  Vector* order       = createVector(0);
+  Vector* stack       = createVector(0);
+  Vector* visited     = createVector(0);
+  int stackCapacity   = NODE_STACK_CAPACITY;
+  int* nextChild      = memAlloc(MEM_LIST, sizeof(int) * stackCapacity);
+  Node *nodePtr, *childPtr;
   int i;
 
-  for(i = 0; i < (*rootNode)->numOfChild; i++){
-    childPtr = (*rootNode)->children[i];
-    addListLast(childPtr->directDom, (*rootNode));
-    if((childPtr->visitFlag & 8) == 0)
-      setAllDirectDom(&childPtr);
+  addNumberedNode(visited, *rootNode, INDEX_ORDER);
+  nextChild[0] = 0;
+  vectorAddLast(stack, *rootNode);
+
+  while(stack->length > 0){
+    nodePtr = VECTOR_LAST(stack);
+    if(nextChild[stack->length - 1] == nodePtr->numOfChild){
+      vectorAddLast(order, vectorRemoveLast(stack));
+      continue;
+    }
+
+    childPtr = nodePtr->children[nextChild[stack->length - 1]++];
+    if(getNodeIndex(visited, childPtr, INDEX_ORDER) == NOT_NUMBERED){
+      addNumberedNode(visited, childPtr, INDEX_ORDER);
+      if(stack->length == stackCapacity){
+        nextChild = memRealloc(MEM_LIST, nextChild, sizeof(int) * stackCapacity, sizeof(int) * stackCapacity * 2);
+        stackCapacity *= 2;
+      }
+      nextChild[stack->length] = 0;
+      vectorAddLast(stack, childPtr);
+    }
   }
+
+  /* postorder to reverse postorder */
+  for(i = 0; i < order->length / 2; i++){
+    nodePtr = order->item[i];
+    order->item[i] = order->item[order->length - 1 - i];
+    order->item[order->length - 1 - i] = nodePtr;
+  }
+
+  memFree(MEM_LIST, nextChild, sizeof(int) * stackCapacity);
+  destroyVector(stack);
+  destroyVector(visited);
+  return order;
+}
+
+/*
+ *  isNodeOrderValid
+ *  (rootNode) keep some order and no node in them had its children
+ *  changed since they were built. The reverse postorder (the rank order when it
+ *  is the only one) is checked from the root down, a node is only read
+ *  after the node it was reached from, so a node taken out of the CFG
+ *  and destroyed is never read: the edge to it was removed first and
+ *  stamped the node before it.
+ */
+static int isNodeOrderValid(Node* rootNode){
+  Vector* order = rootNode->order[ORDER_RPO] != NULL ? rootNode->order[ORDER_RPO] : rootNode->order[ORDER_RANK];
+  int k;
+
+  if(order == NULL)
+    return 0;
+  for(k = 0; k < order->length; k++)
+    if(((Node*)order->item[k])->edgeStamp > rootNode->orderStamp)
+      return 0;
+  return 1;
+}
+
+/*
+ *  dropNodeOrder
+ *  Give back every order kept in (rootNode). Orders built under another
+ *  Allocator cannot be given to the one installed now: those built with
+ *  malloc are given back to malloc, the others are left to their own
+ *  Allocator (an Arena release them with the session).
+ */
+static void dropNodeOrder(Node* rootNode){
+  Allocator allocator;
+  int k, isOtherAllocator = rootNode->orderAllocator != getAllocatorVersion();
+
+  if(isOtherAllocator && rootNode->orderAllocator == MALLOC_VERSION){
+    allocator = getAllocator();
+    setAllocator(NULL);
+    for(k = 0; k < NUM_OF_ORDER; k++)
+      destroyVector(rootNode->order[k]);
+    setAllocator(&allocator);
+  }
+  else if(!isOtherAllocator){
+    for(k = 0; k < NUM_OF_ORDER; k++)
+      destroyVector(rootNode->order[k]);
+  }
+
+  for(k = 0; k < NUM_OF_ORDER; k++)
+    rootNode->order[k] = NULL;
 }
 
 /**
- *  This function should make sure none of the node in the node
- *  tree have more than 2 parents. If case Tree A happens,
- *  splitNode shall create NodeG and form Tree B.
- *
+ *  getNodeOrder
+ *  Return the nodes reached from (rootNode) in the order of (kind). The
+ *  order is built on the first call and kept inside (rootNode) until an
+ *  edge of its CFG change, so a phase that walk the CFG again and again
+ *  does not rebuild it. Checking that no edge changed read every node of
+ *  the order once but allocate nothing. The Vector belong to (rootNode),
+ *  do not destroy it and do not keep it after changing an edge. Only call
+ *  it with the root of a CFG, a walk from an inner node is kept as long
+ *  and cost as much; use assembleList/getReversePostorder and destroy the
+ *  Vector for those.
+ */
+Vector* getNodeOrder(Node* rootNode, OrderKind kind){
+  Vector* rpoOrder;
+  int k;
 
+  if(rootNode == NULL)
+    ThrowError(ERR_NULL_NODE, "Empty Tree input detected!");
+
+  if(rootNode->orderAllocator != getAllocatorVersion() || !isNodeOrderValid(rootNode)){
+    dropNodeOrder(rootNode);
+    rootNode->orderStamp      = edgeClock;
+    rootNode->orderAllocator  = getAllocatorVersion();
+  }
+
+  if(rootNode->order[kind] != NULL)
+    return rootNode->order[kind];
+
+  switch(kind){
+    case ORDER_RANK:
+      rootNode->order[kind] = assembleList(&rootNode);
+      break;
+    case ORDER_RPO:
+      rootNode->order[kind] = getReversePostorder(&rootNode);
+      break;
+    case ORDER_PO:
+      rpoOrder              = getNodeOrder(rootNode, ORDER_RPO);
+      rootNode->order[kind] = createVector(rpoOrder->length);
+      for(k = rpoOrder->length - 1; k >= 0; k--)
+        vectorAddLast(rootNode->order[kind], rpoOrder->item[k]);
+      break;
+    default:
+      ThrowError(ERR_UNHANDLE_ERROR, "Unknown order %d", kind);
+  }
+  return rootNode->order[kind];
+}
+
+/**
+ *  invalidateNodeOrder
+ *  Forget every order holding (node) that getNodeOrder kept. addChild,
+ *  removeChild, splitNode and splitCriticalEdges already call it, only
+ *  call it after changing the children of (node) by hand.
+ */
+void invalidateNodeOrder(Node* node){
+  node->edgeStamp = ++edgeClock;
+}
+
+/**
+ *  addDirectDom
+ *  Put (domNode) at the end of the directDom of (node). addChild already
+ *  do it for every edge, only use it on a node built by hand.
+ */
+void addDirectDom(Node** node, Node** domNode){
+  (*node)->directDom = addEdge((*node)->directDom, &(*node)->numOfDirectDom, \
+                               &(*node)->directDomCapacity, (*node)->inlineDirectDom, *domNode);
+}
+
+/*
+ *  The directDom(predecessor) of every node is kept up to date by addChild,
+ *  removeChild and splitNode, so there is nothing left to assign. Kept for
+ *  the calling sequence in UserManual.
+ */
+void setAllDirectDom(Node** rootNode){
+  if(*rootNode == NULL)
+    ThrowError(ERR_NULL_NODE, "Empty Tree input detected!");
+}
+
+/*
+ *  findEdge
+ *  Position of the first (node) inside an edge array, -1 when it is not there
+ */
+static int findEdge(Node** edge, int numOfEdge, Node* node){
+  int position;
+
+  for(position = 0; position < numOfEdge; position++)
+    if(edge[position] == node)
+      return position;
+
+  return -1;
+}
+
+/*
+ *  splitJoin
+ *  Give (joinNode) a chain of new node so it keep only its first two
+ *  directDom. The last directDom is moved to the first new node, the one
+ *  before it to the second and so on, the second new node point to the
+ *  first, and the first new node take the children and the Expression
+ *  block of (joinNode).
  *
- *
+ *     p1  p2  p3  p4             p1  p2
+ *       \  \  /  /                 \ /
+ *        (join)          =>      (join)   p3
+ *          |                         \   /
+ *         (c)                        (new2)   p4
+ *                                        \   /
+ *                                        (new1)
+ *                                          |
+ *                                         (c)
+ */
+static void splitJoin(Node* joinNode){
+  int numOfNew        = joinNode->numOfDirectDom - 2;
+  Node** newNode      = memAlloc(MEM_LIST, sizeof(Node*) * numOfNew);
+  Node** domNode      = memAlloc(MEM_LIST, sizeof(Node*) * numOfNew);
+  Node *upperNode, *childPtr;
+  int i, position;
+
+  /*  the directDom are taken from the back, joinNode keep the first two */
+  for(i = 0; i < numOfNew; i++){
+    domNode[i] = joinNode->directDom[joinNode->numOfDirectDom - 1 - i];
+    newNode[i] = createNode(joinNode->rank > domNode[i]->rank ? domNode[i]->rank + 1 : joinNode->rank + 1);
+  }
+  joinNode->numOfDirectDom = 2;
+
+  for(i = 0; i < numOfNew; i++){
+    upperNode = i == numOfNew - 1 ? joinNode : newNode[i + 1];
+    addDirectDom(&newNode[i], &upperNode);
+    addDirectDom(&newNode[i], &domNode[i]);
+    newNode[i]->parent = upperNode;
+
+    position = findEdge(domNode[i]->children, domNode[i]->numOfChild, joinNode);
+    if(position < 0)
+      ThrowError(ERR_UNHANDLE_ERROR, "There was a unhandled exception error");
+    domNode[i]->children[position] = newNode[i];
+  }
+
+  /*  the first new node take the children, and the Expression, of joinNode */
+  for(i = 0; i < joinNode->numOfChild; i++){
+    childPtr = joinNode->children[i];
+    newNode[0]->children = addEdge(newNode[0]->children, &newNode[0]->numOfChild, \
+                                   &newNode[0]->childCapacity, newNode[0]->inlineChild, childPtr);
+    /*  in place, the phiFunction operands follow the directDom order */
+    position = findEdge(childPtr->directDom, childPtr->numOfDirectDom, joinNode);
+    if(position < 0)
+      addDirectDom(&childPtr, &newNode[0]);
+    else
+      childPtr->directDom[position] = newNode[0];
+    childPtr->parent = newNode[0];
+  }
+  joinNode->numOfChild = 0;
+
+  destroyLinkedList(newNode[0]->block);
+  newNode[0]->block = joinNode->block;
+  joinNode->block   = NULL;
+  for(i = 1; i < numOfNew; i++){
+    destroyLinkedList(newNode[i]->block);
+    newNode[i]->block = NULL;
+  }
+
+  /*  join -> new(n) -> ... -> new1 */
+  joinNode->children = addEdge(joinNode->children, &joinNode->numOfChild, &joinNode->childCapacity, \
+                               joinNode->inlineChild, newNode[numOfNew - 1]);
+  for(i = numOfNew - 1; i > 0; i--)
+    newNode[i]->children = addEdge(newNode[i]->children, &newNode[i]->numOfChild, \
+                                   &newNode[i]->childCapacity, newNode[i]->inlineChild, newNode[i - 1]);
+  joinNode->parent = joinNode->directDom[1];
+
+  memFree(MEM_LIST, newNode, sizeof(Node*) * numOfNew);
+  memFree(MEM_LIST, domNode, sizeof(Node*) * numOfNew);
+}
+
 /**
- * brief @ To split the node that had more than 2 parents.
+ * brief @ To split every node that had more than 2 parents.
  * Example:
  *               TREE A:           TREE B:
  *                 (A)              (A)
@@ -342,151 +966,194 @@ void setAllDirectDom(Node** rootNode){
  *
  * brief @ The expression block in NodeF will be moved to newNode
  * brief @ The expression block in NodeF become empty then
+ * brief @ Splitting a node never change the number of directDom of any other node, so every
+ *         node to split is found by one walk and split in turn, each edge is moved only once.
  *
- * param @ Node* node  - The tree that is going to use this function to find all the domFrontiers of it.
+ * param @ Node** rootNode  - The tree to split.
  *
- * retval@ LinkedList* - The union of domFrontiers of the input argument, 'Node** root' is going to return.
+ * retval@ void  - Nothing to return.
  **/
 void splitNode(Node** rootNode){
-  LinkedList*   splitList = createLinkedList();
-  LinkedList*   nodeList  = assembleList(rootNode);
-  ListElement*  checkListHead = NULL;
-  ListElement*  tempNode   = NULL;
-  int i, count, rank, positionOfSplitNode;
-
-  /* build a list for the children those have more than 1 parent */
-  ListElement*  tempHead  = nodeList->head;
-  while(tempHead){
-    for(i = 0; i < ((Node*)tempHead->node)->numOfChild; i++){
-      if(((Node*) tempHead->node)->children[i]->parent != tempHead->node && \
-          ((Node*) tempHead->node)->children[i]->imdDom != tempHead->node)
-        addListLast(splitList, ((Node*) tempHead->node)->children[i]);
-    }
-    tempHead = tempHead->next;
+  if(*rootNode == NULL)
+    ThrowError(ERR_NULL_NODE, "Empty Tree input detected!");
+
+  Vector* nodeList    = getNodeOrder(*rootNode, ORDER_RANK);
+  Vector* joinList    = createVector(0);
+  Vector* checklist   = createVector(nodeList->length);
+  Node* tempNode;
+  int k;
+
+  for(k = 0; k < nodeList->length; k++){
+    tempNode = nodeList->item[k];
+    if(getNodeIndex(checklist, tempNode, INDEX_ORDER) != NOT_NUMBERED)
+      continue;
+    addNumberedNode(checklist, tempNode, INDEX_ORDER);
+    if(tempNode->numOfDirectDom > 2)
+      vectorAddLast(joinList, tempNode);
   }
 
-  tempHead = splitList->head;
+  for(k = 0; k < joinList->length; k++)
+    splitJoin(joinList->item[k]);
 
-  /* check each element inside the split list,
-     if one of the elements appear twice, that means it had more than 2 parents.
-  */
-  while(tempHead){
-    count = 0;
-    checkListHead = tempHead;
-    tempNode = tempHead->node; // store the current pointing node
+  if(joinList->length)
+    invalidateNodeOrder(*rootNode);
+  destroyVector(joinList);
+  destroyVector(checklist);
+}
 
-    while(checkListHead){
-      if(checkListHead->node == tempNode)
-        count++;
+/*
+ *  isOnlyEntry
+ *  return 1 when every directDom of (lowerNode) but (newNode) is dominated
+ *  by lowerNode, so (newNode) is the only way into it. The imdDom must
+ *  already be found, a directDom without imdDom other than (rootNode) is
+ *  not reached and does not count.
+ */
+static int isOnlyEntry(Node* rootNode, Node* lowerNode, Node* newNode){
+  Node* domPtr;
+  int i;
 
-      //more than 2 parent for (checkListHead->node), so need to separate the parents out
-      if(count == 2)
-        break;
+  for(i = 0; i < lowerNode->numOfDirectDom; i++){
+    domPtr = lowerNode->directDom[i];
+    if(domPtr == newNode || (domPtr != rootNode && domPtr->imdDom == NULL))
+      continue;
+    while(domPtr != NULL && domPtr != lowerNode)
+      domPtr = domPtr->imdDom;
+    if(domPtr == NULL)
+      return 0;
+  }
+  return 1;
+}
 
-      checkListHead = checkListHead->next;
-    }
+/**
+ * brief @ Put an empty node on every critical edge, an edge from a node with more than one child
+ *         to a node with more than one directDom.
+ * Example:
+ *                 (A)                     (A)
+ *                /   \                   /   \
+ *              (B)    \       =>       (B)   (new1)
+ *              / \     |       =>       / \     |
+ *            (D)  \    |             (D) (new2) |
+ *                  \   |                    \  |
+ *                   (C)                      (C)
+ *
+ * brief @ The new node take the place of the edge inside the children of the upper node and inside
+ *         the directDom of the lower node, so the order of both is kept. It get the rank after the
+ *         upper node, the upper node as parent, imdDom and lastBrhDom, and the lower node as
+ *         domFrontiers when the domFrontiers were already found.
+ * brief @ When the edge was the only way into the lower node from outside the nodes it dominate
+ *         (the entry of a loop), the new node dominate the lower node instead: the lower node get
+ *         it as imdDom and it get the domFrontiers of the lower node but the lower node itself.
+ *         The imdDom of no other node change. The lastBrhDom of the lower node is not redone,
+ *         call setLastBrhDom again before setAllImdDom.
+ * brief @ Splitting an edge never change the number of children or directDom of any node, so every
+ *         critical edge is found by one walk and split in place.
+ *
+ * param @ Node** rootNode  - The tree to split.
+ *
+ * retval@ Vector* - The new nodes in the order they were put, destroy it after use.
+ **/
+Vector* splitCriticalEdges(Node** rootNode){
+  if(rootNode == NULL || *rootNode == NULL)
+    ThrowError(ERR_NULL_NODE, "Empty Tree input detected!");
 
-    if(count == 2)
-      break;
+  Vector* nodeList  = getNodeOrder(*rootNode, ORDER_RPO);
+  Vector* newList   = createVector(0);
+  Node *nodePtr, *childPtr, *newNode;
+  int i, j, k, position, isDominating;
+
+  for(k = 0; k < nodeList->length; k++){
+    nodePtr = nodeList->item[k];
+    if(nodePtr->numOfChild < 2)
+      continue;
+
+    for(i = 0; i < nodePtr->numOfChild; i++){
+      childPtr = nodePtr->children[i];
+      if(childPtr->numOfDirectDom < 2)
+        continue;
+
+      newNode = createNode(nodePtr->rank + 1);
+      newNode->children = addEdge(newNode->children, &newNode->numOfChild, \
+                                  &newNode->childCapacity, newNode->inlineChild, childPtr);
+      addDirectDom(&newNode, &nodePtr);
+      newNode->parent     = nodePtr;
+      newNode->imdDom     = nodePtr;
+      newNode->lastBrhDom = nodePtr;
+
+      nodePtr->children[i] = newNode;
+      position = findEdge(childPtr->directDom, childPtr->numOfDirectDom, nodePtr);
+      if(position < 0)
+        ThrowError(ERR_UNHANDLE_ERROR, "There was a unhandled exception error");
+      childPtr->directDom[position] = newNode;
+      if(childPtr->parent == nodePtr)
+        childPtr->parent = newNode;
+
+      /*  only the upper node can be the imdDom of a node entered through the edge alone */
+      isDominating = childPtr != *rootNode && childPtr->imdDom == nodePtr && \
+                     isOnlyEntry(*rootNode, childPtr, newNode);
+      if(isDominating)
+        childPtr->imdDom = newNode;
+      if(nodePtr->domFrontiers != NULL){
+        newNode->domFrontiers = createVector(1);
+        if(!isDominating)
+          vectorAddLast(newNode->domFrontiers, childPtr);
+        for(j = 0; isDominating && childPtr->domFrontiers != NULL && j < childPtr->domFrontiers->length; j++)
+          if(childPtr->domFrontiers->item[j] != childPtr)
+            vectorAddLast(newNode->domFrontiers, childPtr->domFrontiers->item[j]);
+      }
 
-    tempHead = tempHead->next;
+      vectorAddLast(newList, newNode);
+    }
   }
 
-  if(!tempHead)
-    return;
-
-  /* compare the rank of both of the nodes that is going to be the parents of newNode */
-  if(((Node*)checkListHead->node)->rank > ((Node*)checkListHead->node)->parent->rank)
-    rank = ((Node*)checkListHead->node)->parent->rank + 1;
-  else
-    rank = ((Node*)checkListHead->node)->rank + 1;
-
-  Node* newNode = createNode(rank);
+  if(newList->length)
+    invalidateNodeOrder(*rootNode);
+  return newList;
+}
 
-  positionOfSplitNode = 0;
+static void destroyExpressionPayload(void* payload){
+  freeExpression((Expression*)payload);
+}
 
-  /*  find the place of the Node(that is more than 2 parent & going to be splitted) in its parent
-      its parent may own more than 1 child
-   */
-  while(positionOfSplitNode < ((Node*)checkListHead->node)->parent->numOfChild && \
-        ((Node*)checkListHead->node)->parent->children[positionOfSplitNode] != ((Node*)checkListHead->node))
-    positionOfSplitNode++;
+/**
+ *  destroyNode
+ *  Free the node together with its expression block, its spilled
+ *  children/directDom array and its domFrontiers. The children themselves are
+ *  not freed, use destroyCFG to free a whole graph.
+ */
+void destroyNode(Node* node){
+  if(node == NULL)
+    return;
 
-  if(!((Node*)checkListHead->node)->parent->children[positionOfSplitNode])
-    ThrowError(ERR_UNHANDLE_ERROR, "There was a unhandled exception error");
+  destroyLinkedListWithPayload(node->block, destroyExpressionPayload);
+  destroyVector(node->domFrontiers);
+  dropNodeOrder(node);
+  freeEdge(node->children, node->childCapacity, node->inlineChild);
+  freeEdge(node->directDom, node->directDomCapacity, node->inlineDirectDom);
+  memFree(MEM_NODE, node, sizeof(Node));
+}
 
-  /*  in case the splitNode(had >2 parent at the first) had any children
-      link the newNode with the children of splitNode
-  */  
-  for(i = 0; i < ((Node*)checkListHead->node)->numOfChild; i++)
-    addChild(&newNode, &((Node*)checkListHead->node)->children[i]);
+/**
+ *  destroyCFG
+ *  Free every node that can be reached from (rootNode). A node with more
+ *  than one parent or on a loop is only freed once.
+ */
+void destroyCFG(Node* rootNode){
+  if(rootNode == NULL)
+    return;
 
-  /*  break the children of the splitNode */
-  if(((Node*)checkListHead->node)->numOfChild){
-    ((Node*)checkListHead->node)->numOfChild   = 0;
-    ((Node*)checkListHead->node)->children     = NULL;
-  }
+  Vector* nodeList      = createVector(0);
+  Node* nodePtr;
+  int i, k;
 
-  /* link the splitNode to the newNode */
-  addChild(((Node**)&checkListHead->node), &newNode);
-  
-  /*  pass the expression block of splitNode to newNode  */
-  newNode->block = ((Node*)checkListHead->node)->block;
-  ((Node*)checkListHead->node)->block = NULL;
-  
-  /* add the newNode created in the children list of the splitNode(had >2 parent at the first) and its parent */
-  ((Node*)checkListHead->node)->parent->children[positionOfSplitNode] = newNode;
-
-  /* re-assign parent */
-  nodeList  = assembleList(rootNode);
-  tempHead  = nodeList->head;
-  while(tempHead){
-    for(i = 0; i < ((Node*)tempHead->node)->numOfChild; i++){
-      if(((Node*)tempHead->node)->children[i]->parent != tempHead->node)
-        ((Node*)tempHead->node)->children[i]->parent = tempHead->node;
-    }
-    tempHead = tempHead->next;
-  }
-  
-  //check is any node's parent >2
-  nodeList  = assembleList(rootNode);
-  tempHead  = nodeList->head;
-  while(tempHead){
-    for(i = 0; i < ((Node*)tempHead->node)->numOfChild; i++){
-      if(((Node*) tempHead->node)->children[i]->parent != tempHead->node && \
-          ((Node*) tempHead->node)->children[i]->imdDom != tempHead->node)
-        addListLast(splitList, ((Node*) tempHead->node)->children[i]);
-    }
-    tempHead = tempHead->next;
+  addNumberedNode(nodeList, rootNode, INDEX_ORDER);
+  for(k = 0; k < nodeList->length; k++){
+    nodePtr = nodeList->item[k];
+    for(i = 0; i < nodePtr->numOfChild; i++)
+      addNumberedNode(nodeList, nodePtr->children[i], INDEX_ORDER);
   }
 
-  tempHead = splitList->head;
-  while(tempHead){
-    count = 0;
-    checkListHead = tempHead;
-    tempNode = tempHead->node; // store the current pointing node
+  for(k = 0; k < nodeList->length; k++)
+    destroyNode(nodeList->item[k]);
 
-    while(checkListHead){
-      if(checkListHead->node == tempNode)
-        count++;
-
-      //more than 2 parent for (checkListHead->node), so need to separate the parents out
-      if(count == 2)
-        break;
-
-      checkListHead = checkListHead->next;
-    }
-
-    if(count == 2)
-      break;
-    
-    tempHead = tempHead->next;
-  }
-  
-  if(!tempHead)
-    return;
-  
-  //recursive
-  splitNode(rootNode);
-
-}
\ No newline at end of file
+  destroyVector(nodeList);
+}
@@ -3,20 +3,105 @@
 
 typedef struct Node_t Node;
 #include "LinkedList.h"
+#include "Vector.h"
 #include "ErrorObject.h"
 #include "ExpressionBlock.h"
 
+/**
+ *  Almost every block of a CFG has one or two successor and predecessor,
+ *  so the first NODE_INLINE_EDGE of them are kept inside the Node itself
+ *  (inlineChild/inlineDirectDom). children and directDom point to the
+ *  inline array until a node get more edge than that, then the edges are
+ *  moved to the heap.
+ *
+ *  Loop over the successor / predecessor of a node:
+ *    for(i = 0; i < node->numOfChild; i++)      node->children[i]
+ *    for(i = 0; i < node->numOfDirectDom; i++)  node->directDom[i]
+ */
+#define NODE_INLINE_EDGE  2
+
+/**
+ *  Every traversal that has to remember the visited node own one
+ *  VisitKind. A node is visited when its visitMark of that kind equal
+ *  the current epoch of the kind, so startVisit() forget every mark in
+ *  O(1) instead of walking the graph to clear them. A new traversal only
+ *  need a new VisitKind before NUM_OF_VISIT.
+ *
+ *    startVisit(VISIT_PHI);
+ *    if(!isVisited(node, VISIT_PHI))
+ *      markVisited(node, VISIT_PHI);
+ */
+typedef enum{
+  VISIT_SSA,      // assignAllNodeSSA
+  VISIT_PHI,      // allocPhiFunc
+  VISIT_LIVE,     // getAllLiveList
+  NUM_OF_VISIT
+}VisitKind;
+
+/**
+ *  The orders a CFG is walked in. getNodeOrder keep them inside the
+ *  node the walk start from and build them again only after an edge of
+ *  that CFG was added, removed or moved. Every edge change stamp the
+ *  node whose children changed (edgeStamp) with a new number, the orders
+ *  are still good while no node in them has a stamp newer than the
+ *  orders (orderStamp). Changing the edges of another CFG leave them
+ *  alone. They are also dropped when another Allocator was installed
+ *  since they were built (orderAllocator), see Arena.h.
+ */
+typedef enum{
+  ORDER_RANK,     // assembleList
+  ORDER_RPO,      // getReversePostorder
+  ORDER_PO,       // ORDER_RPO backward
+  NUM_OF_ORDER
+}OrderKind;
+
+/**
+ *  The id of a node count every node ever created, so a pass must not
+ *  size its scratch space by it. A pass number the nodes it work on
+ *  0 .. n - 1 with its own IndexKind instead and size the scratch by n.
+ *  The number of a node is only trusted when the Vector it was given
+ *  from still hold the node at that place, so a number left by another
+ *  CFG or an older pass is never taken and nothing has to be cleared.
+ *
+ *    numberNodes(order, INDEX_ORDER);
+ *    k = getNodeIndex(order, node, INDEX_ORDER);   // NOT_NUMBERED when not in order
+ *
+ *  INDEX_ORDER only last until the pass return, a structure keeping its
+ *  number longer own a kind of its own.
+ */
+typedef enum{
+  INDEX_ORDER,      // scratch of one pass
+  INDEX_DOM_TREE,   // createDomTree
+  INDEX_LOOP,       // createLoopForest
+  INDEX_UPDATER,    // createDomUpdater
+  NUM_OF_INDEX
+}IndexKind;
+
+#define NOT_NUMBERED  -1
+
 struct Node_t{
+  int id;
   int rank;
-  int visitFlag;
+  int loopDepth;
+  int visitMark[NUM_OF_VISIT];
+  int nodeIndex[NUM_OF_INDEX];
   LinkedList* block;
   Node* lastBrhDom;
   Node* imdDom;
   Node* parent;
   int numOfChild;
+  int childCapacity;
   Node** children;
-  LinkedList* domFrontiers;
-  LinkedList* directDom;
+  Vector* domFrontiers;
+  int numOfDirectDom;
+  int directDomCapacity;
+  Node** directDom;
+  Node* inlineChild[NODE_INLINE_EDGE];
+  Node* inlineDirectDom[NODE_INLINE_EDGE];
+  Vector* order[NUM_OF_ORDER];
+  int orderStamp;
+  int orderAllocator;
+  int edgeStamp;
 };
 
 #define FIND_SAME_NODE(testRankNode_1, testRankNode_2)      \
@@ -28,19 +113,35 @@ struct Node_t{
           }
 
 Node* createNode(int thisRank);
+int getNumOfNode(void);
+void startVisit(VisitKind kind);
+void markVisited(Node* node, VisitKind kind);
+int isVisited(Node* node, VisitKind kind);
+void numberNodes(Vector* nodeList, IndexKind kind);
+int addNumberedNode(Vector* nodeList, Node* node, IndexKind kind);
+int getNodeIndex(Vector* nodeList, Node* node, IndexKind kind);
 void addChild(Node** parentNode, Node** childNode);
+void removeChild(Node** parentNode, Node** childNode);
 void setLastBrhDom(Node** rootNode);
 
-LinkedList* assembleList(Node **rootNode);
+Vector* assembleList(Node **rootNode);
+Vector* getReversePostorder(Node** rootNode);
+Vector* getNodeOrder(Node* rootNode, OrderKind kind);
+void invalidateNodeOrder(Node* node);
 
 void getImdDom(Node* nodeA);
 void setAllImdDom(Node** rootNode);
 
+void addDirectDom(Node** node, Node** domNode);
 void setAllDirectDom(Node** rootNode);
 void splitNode(Node** rootNode);
+Vector* splitCriticalEdges(Node** rootNode);
+
+Vector* getNodeDomFrontiers(Node* node);
+Vector* getAllDomFrontiers(Node** root);
 
-LinkedList* getNodeDomFrontiers(Node* node);
-LinkedList* getAllDomFrontiers(Node** root);
+void destroyNode(Node* node);
+void destroyCFG(Node* rootNode);
 
 
 #endif // NodeChain_H
@@ -1,4 +1,6 @@
 #include "PhiFunction.h"
+#include "VersionMap.h"
+#include "Allocator.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <assert.h>
@@ -38,37 +40,51 @@ Subscript getCondition(Node* imdDomNode){
  *  @subs   The subscript that required a phiFunction
  *
  */
-Expression* getPhiFunction(LinkedList* listA, LinkedList* listB, Subscript* subs){
-  Subscript *subsA  = NULL;
-  Subscript *subsB  = NULL;
-  
-  ListElement *ptrA, *ptrB;
-  ptrA = listA->head;
-  ptrB = listB->head;
-  
-  int subsName = subs->name;
-  /*****************************************************************
-   *  Find the latest index for operand A and operand B at this point
-   *****************************************************************/
-  while(ptrA != NULL && ((Subscript*)ptrA->node)->name != subsName)
-    ptrA = ptrA->next;
-  if(ptrA != NULL)
-    subsA = ptrA->node;
-  else
-    ThrowError(ERR_UNDECLARE_VARIABLE, "Undefine reference to Subscript %c", subsName);
-  
-  while(ptrB != NULL && ((Subscript*)ptrB->node)->name != subsName)
-    ptrB = ptrB->next;
-  if(ptrB != NULL)
-    subsB = ptrB->node;
-  else
-    ThrowError(ERR_UNDECLARE_VARIABLE, "Undefine reference to Subscript %c", subsName);
-  
+Expression* getPhiFunction(VersionMap* listA, VersionMap* listB, Subscript* subs){
+  VersionMap* predList[2];
+  predList[0] = listB;
+  predList[1] = listA;
+
+  return getNaryPhiFunction(predList, 2, subs);
+}
+
+/*  getNaryPhiFunction
+ *
+ *  getPhiFunction for any number of parent, one operand is taken
+ *  from every list in the order they are given
+ *
+ *  @predList   predList[i] is the list of subscripts living at
+ *              directDom[i]
+ *  @numOfPred  number of list in predList, at least 2
+ *  @subs       The subscript that required a phiFunction
+ *
+ */
+Expression* getNaryPhiFunction(VersionMap** predList, int numOfPred, Subscript* subs){
+  int i, subsName = subs->name;
+  Subscript* subsPtr;
+
+  if(numOfPred < 2)
+    ThrowError(ERR_INVALID_BRANCH, "PhiFunction need at least 2 parent but got %d", numOfPred);
+
   //Create the phifunction without the condition yet
-  Expression* phiFunction   = createExpression(subs->name, PHI_FUNC, subsA->name, subsB->name, 0);
+  Expression* phiFunction   = createExpression(subsName, PHI_FUNC, subsName, subsName, 0);
   phiFunction->id.index     = subs->index + 1;
-  phiFunction->oprdA.index  = subsA->index;
-  phiFunction->oprdB.index  = subsB->index;
+  phiFunction->phiOprd      = memAlloc(MEM_EXPRESSION, sizeof(Subscript) * numOfPred);
+  phiFunction->numOfPhiOprd = numOfPred;
+
+  /*****************************************************************
+   *  Find the latest index of every operand at this point
+   *****************************************************************/
+  for(i = 0; i < numOfPred; i++){
+    subsPtr = versionMapFind(predList[i], subsName);
+    if(subsPtr == NULL){
+      freeExpression(phiFunction);
+      ThrowError(ERR_UNDECLARE_VARIABLE, "Undefine reference to Subscript %c", subsName);
+    }
+    phiFunction->phiOprd[i] = *subsPtr;
+  }
+  phiFunction->oprdB = phiFunction->phiOprd[0];
+  phiFunction->oprdA = phiFunction->phiOprd[1];
   
   return phiFunction;
 }
@@ -79,51 +95,80 @@ Expression* getPhiFunction(LinkedList* listA, LinkedList* listB, Subscript* subs
  *  a phiFunction and place the required phiFunction for these subscript
  *
  *****************************************************/
-void allocPhiFunc(Node** thisNode){
-  (*thisNode)->visitFlag |= 2;
-  LinkedList* liveList    = getAllLiveList(thisNode, NULL);
-  resetFlag(thisNode, 2);
-  
-  ListElement* livePtr    = liveList->head;
-  LinkedList* listA, *listB;
-  Node *nodeAPtr, *nodeBPtr, *rootPtr;
-  Subscript* subsPtr, condtSubs;
+static void visitPhiFunc(Node** thisNode){
+  markVisited(*thisNode, VISIT_PHI);
+  allocNodePhiFunc(thisNode);
   int i;
-  if((*thisNode)->directDom->length == 2){
-    nodeBPtr = (*thisNode)->directDom->head->node;
-    nodeAPtr = (*thisNode)->directDom->head->next->node;
-    listA = getListTillNode(nodeAPtr);
-    listB = getListTillNode(nodeBPtr);
-    Expression* phiFunction;
-    while(livePtr != NULL){
-      subsPtr     = getLargestIndex(listB, livePtr->node);
-      phiFunction = getPhiFunction(listA, listB, subsPtr);
-      condtSubs   = getCondition((*thisNode)->imdDom);
-      phiFunction->condt = condtSubs;
-      addListFirst((*thisNode)->block, phiFunction);
-      
-      livePtr = livePtr->next;
-    }
-  }
-  
+
   for(i = 0; i < (*thisNode)->numOfChild; i++)
-    if(((*thisNode)->children[i]->visitFlag & 2) == 0)
-      allocPhiFunc(&(*thisNode)->children[i]);
+    if(!isVisited((*thisNode)->children[i], VISIT_PHI))
+      visitPhiFunc(&(*thisNode)->children[i]);
 }
 
+void allocPhiFunc(Node** thisNode){
+  startVisit(VISIT_PHI);
+  visitPhiFunc(thisNode);
+}
 
+/**
+ *  allocNodePhiFunc
+ *
+ *  Place the phiFunction required by (thisNode) only, the children are
+ *  left to allocPhiFunc. A join with any number of directDom get one
+ *  phiFunction operand per directDom, it does not have to go through
+ *  splitNode first
+ *
+ *****************************************************/
+void allocNodePhiFunc(Node** thisNode){
+  int i, numOfPred        = (*thisNode)->numOfDirectDom;
+  if(numOfPred < 2)
+    return;
 
-void resetFlag(Node** anyNode, int bitNumber){
-  Node **rootNode, *nodePtr;
-  nodePtr = (*anyNode);
-  while(nodePtr->rank != 0)
-    nodePtr = nodePtr->parent;
-  rootNode = &nodePtr;
-  
-  LinkedList* nodeList = assembleList(rootNode);
-  ListElement* elmPtr = nodeList->head;
-  while(elmPtr != NULL){
-    ((Node*)elmPtr->node)->visitFlag &= ~(1 << bitNumber);
-    elmPtr = elmPtr->next;
+  startVisit(VISIT_LIVE);
+  LinkedList* liveList    = getAllLiveList(thisNode, NULL);
+  VersionMap** predList   = memAlloc(MEM_LIST, sizeof(VersionMap*) * numOfPred);
+
+  for(i = 0; i < numOfPred; i++)
+    predList[i] = getListTillNode((*thisNode)->directDom[i]);
+
+  addPhiFunc(*thisNode, liveList, predList, numOfPred, (*thisNode)->imdDom);
+
+  for(i = 0; i < numOfPred; i++)
+    destroyVersionMap(predList[i]);
+  memFree(MEM_LIST, predList, sizeof(VersionMap*) * numOfPred);
+  destroyLinkedList(liveList);
+}
+
+/**
+ *  addPhiFunc
+ *
+ *  Put one phiFunction per subscript of (liveList) at the front of
+ *  (thisNode), predList[i] is the latest subscript at the exit of the
+ *  i-th predecessor. The condition is taken from (imdDomNode) when
+ *  there are 2 predecessor. frozenAllocPhiFunc find these on the
+ *  frozen view and call it directly.
+ *
+ *****************************************************/
+void addPhiFunc(Node* thisNode, LinkedList* liveList, VersionMap** predList, \
+                int numOfPred, Node* imdDomNode){
+  ListElement* livePtr    = liveList->head;
+  Subscript* subsPtr;
+  Expression* phiFunction;
+
+  while(livePtr != NULL){
+    subsPtr     = versionMapFind(predList[0], ((Subscript*)livePtr->node)->name);
+    if(subsPtr == NULL)
+      subsPtr   = livePtr->node;
+    phiFunction = getNaryPhiFunction(predList, numOfPred, subsPtr);
+    /*****************************************************************
+     *  A single branch condition only choose between two operand, a
+     *  join with more parent select its operand by the order of
+     *  directDom and leave the condition empty
+     *****************************************************************/
+    if(numOfPred == 2)
+      phiFunction->condt = getCondition(imdDomNode);
+    addListFirst(thisNode->block, phiFunction);
+    
+    livePtr = livePtr->next;
   }
-}
\ No newline at end of file
+}
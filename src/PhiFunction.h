@@ -7,8 +7,11 @@
 #include "NodeChain.h"
 
 void allocPhiFunc(Node** thisNode);
-Expression* getPhiFunction(LinkedList* listA, LinkedList* listB, Subscript* subs);
+void allocNodePhiFunc(Node** thisNode);
+void addPhiFunc(Node* thisNode, LinkedList* liveList, VersionMap** predList, \
+                int numOfPred, Node* imdDomNode);
+Expression* getPhiFunction(VersionMap* listA, VersionMap* listB, Subscript* subs);
+Expression* getNaryPhiFunction(VersionMap** predList, int numOfPred, Subscript* subs);
 Subscript getCondition(Node* imdDomNode);
-void resetFlag(Node** anyNode, int bitNumber);
 
 #endif // PhiFunction_H
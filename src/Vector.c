@@ -0,0 +1,129 @@
+#include "Vector.h"
+#include "Allocator.h"
+#include <string.h>
+#include <assert.h>
+
+#define VECTOR_MIN_CAPACITY 4
+
+/**
+ * createVector
+ *  Calling the function will generate an empty Vector and return it
+ *
+ *  capacity  number of item reserved at the beginning, the Vector
+ *            grow by doubling when it is full
+ */
+Vector* createVector(int capacity){
+  Vector* newVector = memAlloc(MEM_LIST, sizeof(Vector));
+  assert(newVector != NULL);
+
+  if(capacity < VECTOR_MIN_CAPACITY)
+    capacity = VECTOR_MIN_CAPACITY;
+
+  newVector->item     = memAlloc(MEM_LIST, sizeof(void*) * capacity);
+  newVector->length   = 0;
+  newVector->capacity = capacity;
+
+  return newVector;
+}
+
+static void growVector(Vector* vector){
+  vector->item = memRealloc(MEM_LIST, vector->item, sizeof(void*) * vector->capacity, \
+                            sizeof(void*) * vector->capacity * 2);
+  assert(vector->item != NULL);
+  vector->capacity *= 2;
+}
+
+void vectorAddLast(Vector* vector, void *data){
+  if(vector == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: Vector cannot be NULL!");
+
+  if(data == NULL)
+    ThrowError(ERR_NULL_ELEMENT, "ERROR: Element cannot be NULL!");
+
+  if(vector->length == vector->capacity)
+    growVector(vector);
+
+  vector->item[vector->length++] = data;
+}
+
+void vectorAddFirst(Vector* vector, void *data){
+  if(vector == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: Vector cannot be NULL!");
+
+  if(data == NULL)
+    ThrowError(ERR_NULL_ELEMENT, "ERROR: Element cannot be NULL!");
+
+  if(vector->length == vector->capacity)
+    growVector(vector);
+
+  memmove(&vector->item[1], &vector->item[0], sizeof(void*) * vector->length);
+  vector->item[0] = data;
+  vector->length++;
+}
+
+void* vectorRemoveFirst(Vector* vector){
+  void* removedItem;
+
+  if(vector == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: Vector cannot be NULL!");
+
+  if(vector->length == 0)
+    ThrowError(ERR_EMPTY_LIST, "Nothing to remove, empty list here! Return empty element");
+
+  removedItem = vector->item[0];
+  vector->length--;
+  memmove(&vector->item[0], &vector->item[1], sizeof(void*) * vector->length);
+
+  return removedItem;
+}
+
+void* vectorRemoveLast(Vector* vector){
+  if(vector == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: Vector cannot be NULL!");
+
+  if(vector->length == 0)
+    ThrowError(ERR_EMPTY_LIST, "Nothing to remove, empty list here! Return empty element");
+
+  return vector->item[--vector->length];
+}
+
+void* vectorGet(Vector* vector, int index){
+  if(vector == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: Vector cannot be NULL!");
+
+  if(index < 0 || index >= vector->length)
+    ThrowError(ERR_INDEX_OUT_OF_RANGE, "Index %d is out of range of Vector with length %d", \
+               index, vector->length);
+
+  return vector->item[index];
+}
+
+/**
+ * vectorFind
+ *  return the position of the first item equal to (data),
+ *  -1 is returned if (data) is not inside the Vector
+ */
+int vectorFind(Vector* vector, void *data){
+  int i;
+
+  if(vector == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: Vector cannot be NULL!");
+
+  for(i = 0; i < vector->length; i++){
+    if(vector->item[i] == data)
+      return i;
+  }
+  return -1;
+}
+
+/**
+ * destroyVector
+ *  Free the Vector and its array, the items pointed to are not freed
+ */
+void destroyVector(Vector* vector){
+  if(vector == NULL)
+    return;
+
+  memFree(MEM_LIST, vector->item, sizeof(void*) * vector->capacity);
+  memFree(MEM_LIST, vector, sizeof(Vector));
+}
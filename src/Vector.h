@@ -0,0 +1,48 @@
+#ifndef Vector_H
+#define Vector_H
+
+#include "ErrorObject.h"
+
+/**
+ * Vector
+ *
+ *  Object of Vector's type is a growable array of pointer. It keep the
+ *  same add-first/add-last/remove semantics as LinkedList but the items
+ *  are stored side by side, so a loop over a Vector is a linear scan
+ *  instead of a pointer chase.
+ *
+ *  Vector contain:
+ *    1. item       the array of pointer stored
+ *    2. length     number of item stored
+ *    3. capacity   number of item the array can hold before it grow
+ *
+ *     item
+ *      \-[ 0 ][ 1 ][ 2 ][   ][   ]
+ *                     |         |
+ *               length-1     capacity-1
+ *
+ *  Loop over a Vector:
+ *    for(i = 0; i < vector->length; i++)
+ *      nodePtr = vector->item[i];
+ */
+typedef struct{
+  void** item;
+  int length;
+  int capacity;
+}Vector;
+
+#define VECTOR_FIRST(vector)  ((vector)->item[0])
+#define VECTOR_LAST(vector)   ((vector)->item[(vector)->length - 1])
+
+Vector* createVector(int capacity);
+
+void vectorAddLast(Vector* vector, void *data);
+void vectorAddFirst(Vector* vector, void *data);
+
+void* vectorRemoveFirst(Vector* vector);
+void* vectorRemoveLast(Vector* vector);
+void* vectorGet(Vector* vector, int index);
+int vectorFind(Vector* vector, void *data);
+void destroyVector(Vector* vector);
+
+#endif // Vector_H
@@ -0,0 +1,145 @@
+#include "VersionMap.h"
+#include "Allocator.h"
+#include <string.h>
+#include <assert.h>
+
+#define VERSION_MAP_MIN_CAPACITY  8
+
+/*
+ *  Multiplicative hashing, multiply by an odd number never map two
+ *  consecutive variable name (character code) into the same slot
+ */
+#define HASH_NAME(name, numOfSlot)  \
+                ((unsigned int)((unsigned int)(name) * 2654435761u) & ((numOfSlot) - 1))
+
+static void fillSlot(VersionMap* map){
+  int i, slotIdx;
+
+  memset(map->slot, 0xff, sizeof(int) * map->numOfSlot);
+  for(i = 0; i < map->length; i++){
+    slotIdx = HASH_NAME(map->item[i].name, map->numOfSlot);
+    while(map->slot[slotIdx] != VERSION_MAP_EMPTY_SLOT)
+      slotIdx = (slotIdx + 1) & (map->numOfSlot - 1);
+    map->slot[slotIdx] = i;
+  }
+}
+
+/**
+ * createVersionMap
+ *  Calling the function will generate an empty VersionMap and return it
+ *
+ *  capacity  number of variable reserved at the beginning, rounded up to
+ *            a power of two. The VersionMap grow by doubling when it is full
+ */
+VersionMap* createVersionMap(int capacity){
+  VersionMap* newMap = memAlloc(MEM_LIST, sizeof(VersionMap));
+  assert(newMap != NULL);
+
+  /*  HASH_NAME and the probing mask the slot, so keep it a power of two */
+  int roundedCapacity = VERSION_MAP_MIN_CAPACITY;
+  while(roundedCapacity < capacity)
+    roundedCapacity *= 2;
+  capacity = roundedCapacity;
+
+  newMap->item      = memAlloc(MEM_LIST, sizeof(Subscript) * capacity);
+  newMap->defSite   = memAlloc(MEM_LIST, sizeof(Expression*) * capacity);
+  newMap->length    = 0;
+  newMap->capacity  = capacity;
+  newMap->numOfSlot = capacity * 2;
+  newMap->slot      = memAlloc(MEM_LIST, sizeof(int) * newMap->numOfSlot);
+  fillSlot(newMap);
+
+  return newMap;
+}
+
+static void growVersionMap(VersionMap* map){
+  map->item     = memRealloc(MEM_LIST, map->item, sizeof(Subscript) * map->capacity, \
+                             sizeof(Subscript) * map->capacity * 2);
+  map->defSite  = memRealloc(MEM_LIST, map->defSite, sizeof(Expression*) * map->capacity, \
+                             sizeof(Expression*) * map->capacity * 2);
+  map->slot     = memRealloc(MEM_LIST, map->slot, sizeof(int) * map->numOfSlot, \
+                             sizeof(int) * map->numOfSlot * 2);
+  map->capacity  *= 2;
+  map->numOfSlot *= 2;
+  fillSlot(map);
+}
+
+/*
+ *  return the slot that hold (subsName) or the empty slot where
+ *  (subsName) should be placed
+ */
+static int probeSlot(VersionMap* map, int subsName){
+  int slotIdx = HASH_NAME(subsName, map->numOfSlot);
+
+  while(map->slot[slotIdx] != VERSION_MAP_EMPTY_SLOT && \
+        map->item[map->slot[slotIdx]].name != subsName){
+    slotIdx = (slotIdx + 1) & (map->numOfSlot - 1);
+  }
+  return slotIdx;
+}
+
+/**
+ * versionMapFind
+ *  return the latest Subscript of the variable (subsName) stored in the map,
+ *  NULL is returned if the variable was never put
+ */
+Subscript* versionMapFind(VersionMap* map, int subsName){
+  if(map == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: VersionMap cannot be NULL!");
+
+  int itemIdx = map->slot[probeSlot(map, subsName)];
+  if(itemIdx == VERSION_MAP_EMPTY_SLOT)
+    return NULL;
+
+  return &map->item[itemIdx];
+}
+
+Expression* versionMapGetDefSite(VersionMap* map, int subsName){
+  if(map == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: VersionMap cannot be NULL!");
+
+  int itemIdx = map->slot[probeSlot(map, subsName)];
+  if(itemIdx == VERSION_MAP_EMPTY_SLOT)
+    return NULL;
+
+  return map->defSite[itemIdx];
+}
+
+/**
+ * versionMapPut
+ *  Overwrite the Subscript of the same name with (subs), the variable
+ *  keep its position. New variable is put at the end.
+ */
+void versionMapPut(VersionMap* map, Subscript subs, Expression* defSite){
+  if(map == NULL)
+    ThrowError(ERR_NULL_LIST, "ERROR: VersionMap cannot be NULL!");
+
+  int slotIdx = probeSlot(map, subs.name);
+  int itemIdx = map->slot[slotIdx];
+
+  if(itemIdx == VERSION_MAP_EMPTY_SLOT){
+    if(map->length == map->capacity){
+      growVersionMap(map);
+      slotIdx = probeSlot(map, subs.name);
+    }
+    itemIdx = map->length++;
+    map->slot[slotIdx] = itemIdx;
+  }
+
+  map->item[itemIdx]    = subs;
+  map->defSite[itemIdx] = defSite;
+}
+
+/**
+ * destroyVersionMap
+ *  Free the VersionMap, the Expressions in defSite are not freed
+ */
+void destroyVersionMap(VersionMap* map){
+  if(map == NULL)
+    return;
+
+  memFree(MEM_LIST, map->item, sizeof(Subscript) * map->capacity);
+  memFree(MEM_LIST, map->defSite, sizeof(Expression*) * map->capacity);
+  memFree(MEM_LIST, map->slot, sizeof(int) * map->numOfSlot);
+  memFree(MEM_LIST, map, sizeof(VersionMap));
+}
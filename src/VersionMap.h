@@ -0,0 +1,51 @@
+#ifndef VersionMap_H
+#define VersionMap_H
+
+#include "ErrorObject.h"
+#include "ExpressionBlock.h"
+
+#define VERSION_MAP_EMPTY_SLOT  -1
+
+/**
+ * VersionMap
+ *
+ *  Object of VersionMap's type record the latest Subscript of every
+ *  variable together with the Expression that defined it. A variable is
+ *  found by its name in O(1) through an open addressing hash table.
+ *
+ *  VersionMap contain:
+ *    1. item       the Subscript stored, in the order they were first put
+ *    2. defSite    the Expression that defined item[i], NULL if unknown
+ *    3. length     number of variable stored
+ *    4. capacity   number of variable item and defSite can hold
+ *    5. slot       the hash table, each slot is an index into item
+ *                  or VERSION_MAP_EMPTY_SLOT
+ *    6. numOfSlot  size of the hash table, always a power of two and
+ *                  at least twice the length
+ *
+ *     slot    [ -1 ][  1 ][ -1 ][  0 ][ -1 ][  2 ][ -1 ][ -1 ]
+ *                      |           |           |
+ *     item            [ w0 ]      [ x2 ]      [ y1 ]
+ *                        0           1           2
+ *
+ *  Loop over a VersionMap in the order the variables were put:
+ *    for(i = 0; i < map->length; i++)
+ *      subsPtr = &map->item[i];
+ */
+struct VersionMap_t{
+  Subscript* item;
+  Expression** defSite;
+  int length;
+  int capacity;
+  int* slot;
+  int numOfSlot;
+};
+
+VersionMap* createVersionMap(int capacity);
+
+Subscript* versionMapFind(VersionMap* map, int subsName);
+Expression* versionMapGetDefSite(VersionMap* map, int subsName);
+void versionMapPut(VersionMap* map, Subscript subs, Expression* defSite);
+void destroyVersionMap(VersionMap* map);
+
+#endif // VersionMap_H
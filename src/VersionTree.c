@@ -0,0 +1,180 @@
+#include "VersionTree.h"
+#include "Allocator.h"
+#include <stdlib.h>
+#include <assert.h>
+
+#define HEIGHT_OF(tree)   ((tree) == NULL ? 0 : (tree)->height)
+
+/**
+ * shareVersionTree
+ *  return (tree) with one more owner, NULL stay NULL
+ */
+VersionTree* shareVersionTree(VersionTree* tree){
+  if(tree != NULL)
+    tree->refCount++;
+  return tree;
+}
+
+/**
+ * destroyVersionTree
+ *  Give back one owner of (tree), the nodes left without owner are freed
+ */
+void destroyVersionTree(VersionTree* tree){
+  if(tree == NULL || --tree->refCount > 0)
+    return;
+
+  destroyVersionTree(tree->left);
+  destroyVersionTree(tree->right);
+  memFree(MEM_LIST, tree, sizeof(VersionTree));
+}
+
+/*
+ *  The copy own the children of (tree) as well, the caller own the copy
+ */
+static VersionTree* copyVersionTree(VersionTree* tree){
+  VersionTree* newTree = memAlloc(MEM_LIST, sizeof(VersionTree));
+  assert(newTree != NULL);
+
+  *newTree = *tree;
+  newTree->refCount = 1;
+  shareVersionTree(newTree->left);
+  shareVersionTree(newTree->right);
+  return newTree;
+}
+
+static void updateHeight(VersionTree* tree){
+  int leftHeight  = HEIGHT_OF(tree->left);
+  int rightHeight = HEIGHT_OF(tree->right);
+
+  tree->height = (leftHeight > rightHeight ? leftHeight : rightHeight) + 1;
+}
+
+/*
+ *  The rotations only change (tree), which is already a new copy, and
+ *  the child moved up, which is copied here before it is changed. The
+ *  owner of (tree) become the owner of the new root, (tree) give up the
+ *  child it had.
+ */
+static VersionTree* rotateRight(VersionTree* tree){
+  VersionTree* oldLeft = tree->left;
+  VersionTree* newRoot = copyVersionTree(oldLeft);
+
+  tree->left     = newRoot->right;
+  newRoot->right = tree;
+  updateHeight(tree);
+  updateHeight(newRoot);
+  destroyVersionTree(oldLeft);
+
+  return newRoot;
+}
+
+static VersionTree* rotateLeft(VersionTree* tree){
+  VersionTree* oldRight = tree->right;
+  VersionTree* newRoot  = copyVersionTree(oldRight);
+
+  tree->right   = newRoot->left;
+  newRoot->left = tree;
+  updateHeight(tree);
+  updateHeight(newRoot);
+  destroyVersionTree(oldRight);
+
+  return newRoot;
+}
+
+static VersionTree* balanceVersionTree(VersionTree* tree){
+  int balance = HEIGHT_OF(tree->left) - HEIGHT_OF(tree->right);
+  VersionTree* oldChild;
+
+  updateHeight(tree);
+  if(balance > 1){
+    if(HEIGHT_OF(tree->left->left) < HEIGHT_OF(tree->left->right)){
+      oldChild   = tree->left;
+      tree->left = rotateLeft(copyVersionTree(oldChild));
+      destroyVersionTree(oldChild);
+    }
+    return rotateRight(tree);
+  }
+  if(balance < -1){
+    if(HEIGHT_OF(tree->right->right) < HEIGHT_OF(tree->right->left)){
+      oldChild    = tree->right;
+      tree->right = rotateRight(copyVersionTree(oldChild));
+      destroyVersionTree(oldChild);
+    }
+    return rotateLeft(tree);
+  }
+  return tree;
+}
+
+/**
+ * versionTreePut
+ *  return a new VersionTree that hold (subs) as the latest Subscript of
+ *  its variable, (tree) itself is not changed and is still owned by the
+ *  caller
+ */
+VersionTree* versionTreePut(VersionTree* tree, Subscript subs, Expression* defSite){
+  VersionTree* newTree;
+
+  if(tree == NULL){
+    newTree = memAlloc(MEM_LIST, sizeof(VersionTree));
+    assert(newTree != NULL);
+    newTree->subs     = subs;
+    newTree->defSite  = defSite;
+    newTree->left     = NULL;
+    newTree->right    = NULL;
+    newTree->height   = 1;
+    newTree->refCount = 1;
+    return newTree;
+  }
+
+  if(subs.name == tree->subs.name){
+    if(subs.index == tree->subs.index && defSite == tree->defSite)
+      return shareVersionTree(tree);
+    newTree = copyVersionTree(tree);
+    newTree->subs     = subs;
+    newTree->defSite  = defSite;
+    return newTree;
+  }
+
+  newTree = copyVersionTree(tree);
+  if(subs.name < tree->subs.name){
+    destroyVersionTree(newTree->left);
+    newTree->left   = versionTreePut(tree->left, subs, defSite);
+  }else{
+    destroyVersionTree(newTree->right);
+    newTree->right  = versionTreePut(tree->right, subs, defSite);
+  }
+
+  return balanceVersionTree(newTree);
+}
+
+static VersionTree* findVersionTree(VersionTree* tree, int subsName){
+  while(tree != NULL && tree->subs.name != subsName){
+    if(subsName < tree->subs.name)
+      tree = tree->left;
+    else
+      tree = tree->right;
+  }
+  return tree;
+}
+
+/**
+ * versionTreeFind
+ *  return the latest Subscript of the variable (subsName),
+ *  NULL is returned if the variable is not inside the tree
+ */
+Subscript* versionTreeFind(VersionTree* tree, int subsName){
+  tree = findVersionTree(tree, subsName);
+  return tree == NULL ? NULL : &tree->subs;
+}
+
+Expression* versionTreeGetDefSite(VersionTree* tree, int subsName){
+  tree = findVersionTree(tree, subsName);
+  return tree == NULL ? NULL : tree->defSite;
+}
+
+int versionTreeSize(VersionTree* tree){
+  if(tree == NULL)
+    return 0;
+
+  return versionTreeSize(tree->left) + versionTreeSize(tree->right) + 1;
+}
@@ -0,0 +1,53 @@
+#ifndef VersionTree_H
+#define VersionTree_H
+
+#include "ErrorObject.h"
+#include "ExpressionBlock.h"
+
+/**
+ * VersionTree
+ *
+ *  Object of VersionTree's type is a persistent map from the variable name
+ *  to its latest Subscript and the Expression that defined it. It is an
+ *  AVL tree sorted by name and a tree is never changed after it is built:
+ *  versionTreePut copy only the path from the root to the changed variable
+ *  and return the new root, every other subtree is shared with the old one.
+ *
+ *         old root               new root        versionTreePut(old, y3)
+ *          [x1]                   [x1]'
+ *         /    \                 /    \
+ *      [w0]    [y2]           [w0]    [y3]'
+ *
+ *  So a child node of the CFG can derive its own version from the version
+ *  of its parent in O(log n) and the parent's version stay valid for the
+ *  next child.
+ *
+ *  NULL is the empty VersionTree.
+ *
+ *  As the nodes are shared, every node count its owners in refCount: the
+ *  nodes pointing to it and the callers holding it. versionTreePut and
+ *  shareVersionTree hand the caller one more owner of the tree they
+ *  return, give it back with destroyVersionTree once it is not needed.
+ *  A node is freed when its last owner is gone.
+ *
+ *    treeA = versionTreePut(NULL, x1)            treeA         (1 owner)
+ *    treeB = versionTreePut(treeA, y3)           treeA, treeB  (1 owner each)
+ *    destroyVersionTree(treeA)                   x1 stay, treeB share it
+ */
+struct VersionTree_t{
+  Subscript subs;
+  Expression* defSite;
+  VersionTree* left;
+  VersionTree* right;
+  int height;
+  int refCount;
+};
+
+VersionTree* versionTreePut(VersionTree* tree, Subscript subs, Expression* defSite);
+VersionTree* shareVersionTree(VersionTree* tree);
+void destroyVersionTree(VersionTree* tree);
+Subscript* versionTreeFind(VersionTree* tree, int subsName);
+Expression* versionTreeGetDefSite(VersionTree* tree, int subsName);
+int versionTreeSize(VersionTree* tree);
+
+#endif // VersionTree_H
@@ -94,6 +94,21 @@ void customTestAssertLinkedList(LinkedList* expectedList, LinkedList* actualList
     i++;
   }
 } 
+
+/************************************************************************************************
+ * compare every item and the number of items contained between two vector.
+ ************************************************************************************************/
+void customTestAssertVector(Vector* expectedVector, Vector* actualVector, int lineNumber){
+  int i;
+
+  if(expectedVector->length != actualVector->length)
+    CUSTOM_TEST_FAIL(lineNumber, "Expected the number of items in vector was %d actual was %d.", expectedVector->length, actualVector->length);
+
+  for(i = 0; i < expectedVector->length; i++){
+    if(expectedVector->item[i] != actualVector->item[i])
+      CUSTOM_TEST_FAIL(lineNumber, "Expected the [%d] item was 0x%X actual was 0x%X.", i + 1, expectedVector->item[i], actualVector->item[i]);
+  }
+}
 //*******************************************************************************************
 void customTestAssertSubscript(int expectName, int expectSub, Subscript* actual, int lineNumber){
   if(actual->name != expectName)
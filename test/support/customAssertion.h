@@ -21,6 +21,9 @@
 #define TEST_ASSERT_LINKED_LIST(expectedList, actualList);                    \
           customTestAssertLinkedList(expectedList, actualList, __LINE__);
           
+#define TEST_ASSERT_VECTOR(expectedVector, actualVector);                \
+          customTestAssertVector(expectedVector, actualVector, __LINE__);
+
 #define TEST_ASSERT_SUBSCRIPT(expectName, expectSub, actualSubscript);        \
           customTestAssertSubscript(expectName, expectSub, actualSubscript, __LINE__);
 //TEST_ASSERT_EQUAL_CHAIN used to test the addresses of the chain and the addresses stored in the chain
@@ -28,6 +31,7 @@
 void customTestAssertPhiFunction(Expression* expectedPhiFunction, Node** nodeToTest, int lineNumber);
 void customTestAssertNodeAddress(Node* expectedNode, Node* actualNode, int lineNumber);
 void customTestAssertLinkedList(LinkedList* expectedList, LinkedList* actualList, int lineNumber);
+void customTestAssertVector(Vector* expectedVector, Vector* actualVector, int lineNumber);
 void customTestAssertSubscript(int expectName, int expectSub, Subscript* actual, int lineNumber);
 
 #endif // customAssertion_H
@@ -0,0 +1,133 @@
+#include "unity.h"
+#include "Allocator.h"
+#include "Arena.h"
+#include "LinkedList.h"
+#include "Vector.h"
+#include "BitSet.h"
+#include "LcaIndex.h"
+#include "NodeChain.h"
+#include "ExpressionBlock.h"
+#include "GetList.h"
+#include "VersionMap.h"
+#include "VersionTree.h"
+#include "ErrorObject.h"
+#include "CException.h"
+#include <stdlib.h>
+
+int x = 120;
+
+typedef struct{
+  int numOfAlloc;
+  int numOfRealloc;
+  int numOfFree;
+}CountContext;
+
+static void* countAlloc(void* context, int size){
+  ((CountContext*)context)->numOfAlloc++;
+  return malloc(size);
+}
+
+static void* countRealloc(void* context, void* oldPtr, int oldSize, int newSize){
+  ((CountContext*)context)->numOfRealloc++;
+  return realloc(oldPtr, newSize);
+}
+
+static void countFree(void* context, void* ptr, int size){
+  ((CountContext*)context)->numOfFree++;
+  free(ptr);
+}
+
+void setUp(void){
+  resetMemoryStats();
+}
+
+void tearDown(void){
+  setAllocator(NULL);
+}
+
+/**
+ *  setAllocator
+ *  Every allocation of the library should go through the installed
+ *  Allocator with its context.
+ *
+ ***************************************************************************/
+void test_setAllocator_should_route_every_allocation_to_the_installed_Allocator(void){
+  CountContext counter = {0, 0, 0};
+  Allocator countAllocator = {countAlloc, countRealloc, countFree, &counter};
+  setAllocator(&countAllocator);
+
+  Node* nodeA = createNode(0);                  //Node + block
+  Node* nodeB = createNode(1);                  //Node + block
+  addChild(&nodeA, &nodeB);                     //children kept inline
+
+  TEST_ASSERT_EQUAL(4, counter.numOfAlloc);
+  TEST_ASSERT_EQUAL(0, counter.numOfRealloc);
+  TEST_ASSERT_EQUAL_PTR(&counter, getAllocator().context);
+
+  setAllocator(NULL);
+  createLinkedList();
+  TEST_ASSERT_EQUAL(4, counter.numOfAlloc);
+}
+
+/**
+ *  getMemoryStats
+ *  Allocation should be counted under the subsystem that ask for it.
+ *
+ ***************************************************************************/
+void test_getMemoryStats_should_count_per_subsystem(void){
+  createNode(0);
+  createExpression(x, ASSIGN, 3, 0, 0);
+
+  MemoryStats nodeStats = getMemoryStats(MEM_NODE);
+  MemoryStats listStats = getMemoryStats(MEM_LIST);
+  MemoryStats exprStats = getMemoryStats(MEM_EXPRESSION);
+
+  TEST_ASSERT_EQUAL(1, nodeStats.numOfAlloc);
+  TEST_ASSERT_EQUAL(sizeof(Node), nodeStats.bytesAlloc);
+  TEST_ASSERT_EQUAL(1, listStats.numOfAlloc);
+  TEST_ASSERT_EQUAL(1, exprStats.numOfAlloc);
+  TEST_ASSERT_EQUAL(sizeof(Expression), exprStats.bytesAlloc);
+  TEST_ASSERT_EQUAL(0, getMemoryStats(MEM_ERROR).numOfAlloc);
+}
+
+/**
+ *  getMemoryStats
+ *  The ErrorObject and its message are counted under MEM_ERROR and
+ *  freeError should give both of them back.
+ *
+ ***************************************************************************/
+void test_getMemoryStats_should_count_error_and_freeError(void){
+  ErrorObject* err;
+  Try{
+    ThrowError(ERR_NULL_NODE, "abc");
+  } Catch(err){
+    freeError(err);
+  }
+
+  MemoryStats errorStats = getMemoryStats(MEM_ERROR);
+  TEST_ASSERT_EQUAL(2, errorStats.numOfAlloc);
+  TEST_ASSERT_EQUAL(2, errorStats.numOfFree);
+  TEST_ASSERT_EQUAL(sizeof(ErrorObject) + 4, errorStats.bytesAlloc);
+  TEST_ASSERT_EQUAL(errorStats.bytesAlloc, errorStats.bytesFreed);
+}
+
+/**
+ *  beginCompileSession / endCompileSession
+ *  The session install the Arena as Allocator and bring back the
+ *  Allocator installed before it when it end.
+ *
+ ***************************************************************************/
+void test_compileSession_should_bring_back_the_previous_Allocator(void){
+  CountContext counter = {0, 0, 0};
+  Allocator countAllocator = {countAlloc, countRealloc, countFree, &counter};
+  setAllocator(&countAllocator);
+
+  Arena* sessionArena = beginCompileSession();
+  TEST_ASSERT_EQUAL_PTR(sessionArena, getAllocator().context);
+  createNode(0);
+  endCompileSession();
+
+  TEST_ASSERT_EQUAL(0, counter.numOfAlloc);
+  TEST_ASSERT_EQUAL_PTR(&counter, getAllocator().context);
+  TEST_ASSERT_EQUAL(1, getMemoryStats(MEM_NODE).numOfAlloc);
+}
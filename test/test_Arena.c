@@ -0,0 +1,167 @@
+#include "unity.h"
+#include "Arena.h"
+#include "Allocator.h"
+#include "LinkedList.h"
+#include "Vector.h"
+#include "BitSet.h"
+#include "LcaIndex.h"
+#include "VersionMap.h"
+#include "VersionTree.h"
+#include "NodeChain.h"
+#include "ExpressionBlock.h"
+#include "GetList.h"
+#include "ErrorObject.h"
+#include "CException.h"
+#include <stdlib.h>
+
+int x = 120;
+
+void setUp(void){}
+
+void tearDown(void){}
+
+void test_createArena(void){
+  Arena* testArena = createArena(0);
+
+  TEST_ASSERT_NOT_NULL(testArena);
+  TEST_ASSERT_NULL(testArena->head);
+  TEST_ASSERT_EQUAL(ARENA_BLOCK_SIZE, testArena->blockSize);
+  TEST_ASSERT_EQUAL(0, testArena->stats.numOfAlloc);
+  TEST_ASSERT_EQUAL(0, testArena->stats.numOfBlock);
+
+  freeArena(testArena);
+}
+
+/**
+ *  arenaAlloc
+ *  Every allocation should be aligned and should not overlap with the
+ *  previous one. A new block is only reserved when the head block is full.
+ *
+ ***************************************************************************/
+void test_arenaAlloc_should_hand_out_aligned_memory_from_the_same_block(void){
+  Arena* testArena = createArena(64);
+
+  char* ptr1 = arenaAlloc(testArena, 3);
+  char* ptr2 = arenaAlloc(testArena, 8);
+  char* ptr3 = arenaAlloc(testArena, 60);
+
+  TEST_ASSERT_EQUAL(0, (long)ptr1 % ARENA_ALIGN);
+  TEST_ASSERT_EQUAL(0, (long)ptr2 % ARENA_ALIGN);
+  TEST_ASSERT_EQUAL_PTR(ptr1 + ARENA_ALIGN, ptr2);
+  TEST_ASSERT_EQUAL(3, testArena->stats.numOfAlloc);
+  TEST_ASSERT_EQUAL(2, testArena->stats.numOfBlock);
+  TEST_ASSERT_EQUAL(8 + 8 + 64, testArena->stats.bytesUsed);
+  TEST_ASSERT_TRUE(ptr3 < ptr1 || ptr3 >= ptr2 + 8);
+
+  freeArena(testArena);
+}
+
+/**
+ *  arenaAlloc
+ *  Request bigger than the blockSize should get a block of its own.
+ *
+ ***************************************************************************/
+void test_arenaAlloc_given_request_bigger_than_blockSize_should_reserve_bigger_block(void){
+  Arena* testArena = createArena(32);
+
+  arenaAlloc(testArena, 100);
+
+  TEST_ASSERT_EQUAL(1, testArena->stats.numOfBlock);
+  TEST_ASSERT_EQUAL(104, testArena->stats.bytesReserved);
+
+  freeArena(testArena);
+}
+
+/**
+ *  arenaRealloc
+ *  The last allocation should grow in place, the content of others
+ *  should be copied to the new space.
+ *
+ ***************************************************************************/
+void test_arenaRealloc_should_keep_the_content(void){
+  Arena* testArena = createArena(256);
+
+  int* array1 = arenaAlloc(testArena, sizeof(int) * 2);
+  array1[0] = 11;
+  array1[1] = 22;
+  int* grown  = arenaRealloc(testArena, array1, sizeof(int) * 2, sizeof(int) * 4);
+  TEST_ASSERT_EQUAL_PTR(array1, grown);
+
+  arenaAlloc(testArena, 8);
+  int* moved  = arenaRealloc(testArena, grown, sizeof(int) * 4, sizeof(int) * 8);
+  TEST_ASSERT_TRUE(moved != grown);
+  TEST_ASSERT_EQUAL(11, moved[0]);
+  TEST_ASSERT_EQUAL(22, moved[1]);
+
+  freeArena(testArena);
+}
+
+/**
+ *  beginCompileSession / endCompileSession
+ *  Every constructor of the library should allocate from the session arena
+ *  and endCompileSession should report how many allocation was done.
+ *
+ *    [A]       x0 = x0 + x0
+ *     |
+ *    [B]
+ *
+ ***************************************************************************/
+void test_compileSession_should_count_every_allocation_of_the_session(void){
+  Arena* sessionArena = beginCompileSession();
+  TEST_ASSERT_EQUAL_PTR(sessionArena, getSessionArena());
+
+  Node* nodeA = createNode(0);                                //Node + block
+  Node* nodeB = createNode(1);                                //Node + block
+  addChild(&nodeA, &nodeB);                                   //children kept inline
+  addListLast(nodeA->block, createExpression(x, ADDITION, x, x, 0)); //Expression + ListElement
+
+  ArenaStats stats = endCompileSession();
+
+  TEST_ASSERT_EQUAL(6, stats.numOfAlloc);
+  TEST_ASSERT_EQUAL(1, stats.numOfBlock);
+  TEST_ASSERT_NULL(getSessionArena());
+}
+
+/**
+ *  beginCompileSession
+ *  Nested session should bring back the outer session when it end.
+ *
+ ***************************************************************************/
+void test_compileSession_can_be_nested(void){
+  Arena* outerArena = beginCompileSession();
+  createLinkedList();
+  Arena* innerArena = beginCompileSession();
+  createLinkedList();
+  createLinkedList();
+
+  ArenaStats innerStats = endCompileSession();
+  TEST_ASSERT_EQUAL_PTR(outerArena, getSessionArena());
+  TEST_ASSERT_EQUAL(2, innerStats.numOfAlloc);
+
+  ArenaStats outerStats = endCompileSession();
+  TEST_ASSERT_EQUAL(1, outerStats.numOfAlloc);
+  TEST_ASSERT_NULL(getSessionArena());
+}
+
+/**
+ *  beginCompileSession / endCompileSession
+ *  An error thrown inside the session is not taken from the arena, the
+ *  Catch handler can still read and free it after the session ended.
+ *
+ ***************************************************************************/
+void test_compileSession_error_should_outlive_the_session(void){
+  ErrorObject* err = NULL;
+  ArenaStats stats;
+
+  beginCompileSession();
+  Try{
+    ThrowError(ERR_NULL_NODE, "thrown inside %s", "the session");
+  }Catch(err){
+    stats = endCompileSession();
+    TEST_ASSERT_EQUAL(0, stats.numOfAlloc);
+    TEST_ASSERT_EQUAL(ERR_NULL_NODE, err->errorCode);
+    TEST_ASSERT_EQUAL_STRING("thrown inside the session", err->errorMsg);
+    freeError(err);
+  }
+  TEST_ASSERT_NOT_NULL(err);
+}
@@ -0,0 +1,145 @@
+#include "unity.h"
+#include "BitSet.h"
+#include "Arena.h"
+#include "Allocator.h"
+#include "ErrorObject.h"
+#include "CException.h"
+#include <stdlib.h>
+
+void setUp(void){}
+
+void tearDown(void){}
+
+void test_createBitSet(void){
+  BitSet* testSet = createBitSet(100);
+
+  TEST_ASSERT_NOT_NULL(testSet);
+  TEST_ASSERT_EQUAL(2, testSet->numOfWord);
+  TEST_ASSERT_EQUAL(0, bitSetCount(testSet));
+  TEST_ASSERT_EQUAL(-1, bitSetNext(testSet, 0));
+}
+
+/**
+ *  bitSetAdd / bitSetRemove / bitSetHas
+ *  Adding a number bigger than the set should grow the set.
+ *
+ ***************************************************************************/
+void test_bitSetAdd_should_grow_and_bitSetRemove_should_take_out_the_number(void){
+  BitSet* testSet = createBitSet(0);
+
+  bitSetAdd(testSet, 3);
+  bitSetAdd(testSet, 63);
+  bitSetAdd(testSet, 200);
+
+  TEST_ASSERT_TRUE(testSet->numOfWord >= 4);
+  TEST_ASSERT_TRUE(bitSetHas(testSet, 3));
+  TEST_ASSERT_TRUE(bitSetHas(testSet, 63));
+  TEST_ASSERT_TRUE(bitSetHas(testSet, 200));
+  TEST_ASSERT_FALSE(bitSetHas(testSet, 64));
+  TEST_ASSERT_FALSE(bitSetHas(testSet, 5000));
+  TEST_ASSERT_EQUAL(3, bitSetCount(testSet));
+
+  bitSetRemove(testSet, 63);
+  TEST_ASSERT_FALSE(bitSetHas(testSet, 63));
+  TEST_ASSERT_EQUAL(2, bitSetCount(testSet));
+}
+
+/**
+ *  bitSetNext
+ *  Loop over {0, 64, 130} should give the member in increasing order.
+ *
+ ***************************************************************************/
+void test_bitSetNext_should_loop_over_the_member_in_order(void){
+  BitSet* testSet = createBitSet(256);
+  int expected[] = {0, 64, 130};
+  int n, i = 0;
+
+  bitSetAdd(testSet, 130);
+  bitSetAdd(testSet, 0);
+  bitSetAdd(testSet, 64);
+
+  for(n = bitSetNext(testSet, 0); n >= 0; n = bitSetNext(testSet, n + 1))
+    TEST_ASSERT_EQUAL(expected[i++], n);
+  TEST_ASSERT_EQUAL(3, i);
+}
+
+/**
+ *  bitSetUnion / bitSetIntersect / bitSetDifference
+ *
+ *  setA = {1, 70}   setB = {70, 300}
+ *
+ *  setA | setB  = {1, 70, 300}
+ *  setA & setB  = {70}
+ *  setA & ~setB = {1}
+ *
+ ***************************************************************************/
+void test_bitSet_union_intersect_difference(void){
+  BitSet *setA = createBitSet(0), *setB = createBitSet(0), *testSet = createBitSet(0);
+
+  bitSetAdd(setA, 1);
+  bitSetAdd(setA, 70);
+  bitSetAdd(setB, 70);
+  bitSetAdd(setB, 300);
+
+  TEST_ASSERT_TRUE(bitSetUnion(testSet, setA));
+  TEST_ASSERT_TRUE(bitSetUnion(testSet, setB));
+  TEST_ASSERT_FALSE(bitSetUnion(testSet, setB));
+  TEST_ASSERT_EQUAL(3, bitSetCount(testSet));
+  TEST_ASSERT_TRUE(bitSetHas(testSet, 300));
+
+  bitSetClear(testSet);
+  bitSetUnion(testSet, setA);
+  bitSetIntersect(testSet, setB);
+  TEST_ASSERT_EQUAL(1, bitSetCount(testSet));
+  TEST_ASSERT_TRUE(bitSetHas(testSet, 70));
+
+  bitSetClear(testSet);
+  bitSetUnion(testSet, setA);
+  bitSetDifference(testSet, setB);
+  TEST_ASSERT_EQUAL(1, bitSetCount(testSet));
+  TEST_ASSERT_TRUE(bitSetHas(testSet, 1));
+}
+
+void test_bitSetAdd_given_negative_number_should_throw_ERR_INDEX_OUT_OF_RANGE(void){
+  ErrorObject* err;
+  Try{
+    bitSetAdd(createBitSet(0), -1);
+    TEST_FAIL_MESSAGE("Expected ERR_INDEX_OUT_OF_RANGE but no error thrown");
+  } Catch(err){
+    TEST_ASSERT_EQUAL(ERR_INDEX_OUT_OF_RANGE, err->errorCode);
+    TEST_ASSERT_EQUAL_STRING("Number -1 cannot be put into a BitSet", err->errorMsg);
+  }
+}
+
+/**
+ *  SparseSet
+ *  Member should be kept in the order they were added, removing a member
+ *  move the last member into its place and clear empty the set at once.
+ *
+ ***************************************************************************/
+void test_sparseSet_add_remove_clear(void){
+  SparseSet* testSet = createSparseSet(0);
+
+  sparseSetAdd(testSet, 9);
+  sparseSetAdd(testSet, 2);
+  sparseSetAdd(testSet, 500);
+  sparseSetAdd(testSet, 2);
+
+  TEST_ASSERT_EQUAL(3, testSet->length);
+  TEST_ASSERT_EQUAL(9, testSet->dense[0]);
+  TEST_ASSERT_EQUAL(2, testSet->dense[1]);
+  TEST_ASSERT_EQUAL(500, testSet->dense[2]);
+  TEST_ASSERT_TRUE(sparseSetHas(testSet, 500));
+  TEST_ASSERT_FALSE(sparseSetHas(testSet, 3));
+
+  sparseSetRemove(testSet, 9);
+  TEST_ASSERT_EQUAL(2, testSet->length);
+  TEST_ASSERT_EQUAL(500, testSet->dense[0]);
+  TEST_ASSERT_FALSE(sparseSetHas(testSet, 9));
+  TEST_ASSERT_TRUE(sparseSetHas(testSet, 500));
+
+  sparseSetClear(testSet);
+  TEST_ASSERT_EQUAL(0, testSet->length);
+  TEST_ASSERT_FALSE(sparseSetHas(testSet, 2));
+  TEST_ASSERT_FALSE(sparseSetHas(testSet, 500));
+}
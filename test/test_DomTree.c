@@ -0,0 +1,134 @@
+#include "unity.h"
+#include "DomTree.h"
+#include "Dominator.h"
+#include "NodeChain.h"
+#include "ExpressionBlock.h"
+#include "GetList.h"
+#include "customAssertion.h"
+#include "LinkedList.h"
+#include "Vector.h"
+#include "BitSet.h"
+#include "LcaIndex.h"
+#include "VersionMap.h"
+#include "VersionTree.h"
+#include "Arena.h"
+#include "Allocator.h"
+#include "ErrorObject.h"
+#include "CException.h"
+#include <stdlib.h>
+
+void setUp(void){}
+
+void tearDown(void){}
+
+/**
+ *  CFG:                 Dominator tree:
+ *
+ *       [A]                   A
+ *      / | \                / | \
+ *    [B][C] |              B  C  E
+ *     |  |  |                 |
+ *     | [D] |                 D
+ *      \    |
+ *       >[E]<
+ *
+ ***************************************************************************/
+static Node *nodeA, *nodeB, *nodeC, *nodeD, *nodeE;
+
+static void buildCFG(void){
+  nodeA = createNode(0);
+  nodeB = createNode(1);
+  nodeC = createNode(1);
+  nodeD = createNode(2);
+  nodeE = createNode(2);
+
+  addChild(&nodeA, &nodeB);
+  addChild(&nodeA, &nodeC);
+  addChild(&nodeA, &nodeE);
+  addChild(&nodeC, &nodeD);
+  addChild(&nodeB, &nodeE);
+  setAllImdDomSemiNCA(&nodeA);
+}
+
+/**
+ *  dominates / strictlyDominates
+ *
+ ***************************************************************************/
+void test_dominates_should_answer_from_the_entry_and_exit_number(void){
+  buildCFG();
+  Node* lonelyNode = createNode(0);
+  DomTree* tree = createDomTree(&nodeA);
+
+  TEST_ASSERT_EQUAL(5, tree->numOfNode);
+  TEST_ASSERT_TRUE(dominates(tree, nodeA, nodeD));
+  TEST_ASSERT_TRUE(dominates(tree, nodeC, nodeD));
+  TEST_ASSERT_TRUE(dominates(tree, nodeD, nodeD));
+  TEST_ASSERT_FALSE(dominates(tree, nodeB, nodeE));
+  TEST_ASSERT_FALSE(dominates(tree, nodeD, nodeC));
+  TEST_ASSERT_FALSE(dominates(tree, nodeB, nodeD));
+  TEST_ASSERT_FALSE(dominates(tree, nodeA, lonelyNode));
+
+  TEST_ASSERT_TRUE(strictlyDominates(tree, nodeA, nodeE));
+  TEST_ASSERT_FALSE(strictlyDominates(tree, nodeD, nodeD));
+  destroyDomTree(tree);
+}
+
+/**
+ *  createDomTree
+ *  The nodes are in preorder, so the imdDom of every node come before it
+ *  and the subtree of C is C, D side by side
+ *
+ ***************************************************************************/
+void test_createDomTree_should_number_the_nodes_in_preorder(void){
+  buildCFG();
+  DomTree* tree = createDomTree(&nodeA);
+  int p, c = domTreeIndexOf(tree, nodeC);
+
+  TEST_ASSERT_EQUAL_PTR(nodeA, tree->node[0]);
+  TEST_ASSERT_EQUAL(NOT_IN_DOM_TREE, tree->imdDom[0]);
+  for(p = 1; p < tree->numOfNode; p++){
+    TEST_ASSERT_TRUE(tree->imdDom[p] < p);
+    TEST_ASSERT_EQUAL_PTR(tree->node[p]->imdDom, tree->node[tree->imdDom[p]]);
+  }
+
+  TEST_ASSERT_EQUAL(3, tree->childStart[1] - tree->childStart[0]);
+  TEST_ASSERT_EQUAL(1, tree->childStart[c + 1] - tree->childStart[c]);
+  TEST_ASSERT_EQUAL_PTR(nodeD, tree->node[tree->child[tree->childStart[c]]]);
+  TEST_ASSERT_EQUAL(c + 1, domTreeIndexOf(tree, nodeD));
+  TEST_ASSERT_EQUAL(tree->numOfNode - 1, tree->postNum[0]);
+  destroyDomTree(tree);
+}
+
+void test_createDomTree_without_imdDom_should_throw_ERR_NULL_NODE(void){
+  Node* nodeA = createNode(0);
+  Node* nodeB = createNode(1);
+  ErrorObject* err;
+
+  addChild(&nodeA, &nodeB);
+  Try{
+    createDomTree(&nodeA);
+    TEST_FAIL_MESSAGE("Expected ERR_NULL_NODE but none thrown");
+  }Catch(err){
+    TEST_ASSERT_EQUAL(ERR_NULL_NODE, err->errorCode);
+    freeError(err);
+  }
+}
+
+void test_createDomTree_given_NULL_should_throw_ERR_NULL_NODE(void){
+  Node* nodeA = NULL;
+  ErrorObject* err;
+  Try{
+    createDomTree(&nodeA);
+    TEST_FAIL_MESSAGE("Expected ERR_NULL_NODE but none thrown");
+  }Catch(err){
+    TEST_ASSERT_EQUAL(ERR_NULL_NODE, err->errorCode);
+    freeError(err);
+  }
+  Try{
+    createDomTree(NULL);
+    TEST_FAIL_MESSAGE("Expected ERR_NULL_NODE but none thrown");
+  }Catch(err){
+    TEST_ASSERT_EQUAL(ERR_NULL_NODE, err->errorCode);
+    freeError(err);
+  }
+}
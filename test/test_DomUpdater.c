@@ -0,0 +1,280 @@
+#include "unity.h"
+#include "DomUpdater.h"
+#include "Dominator.h"
+#include "NodeChain.h"
+#include "ExpressionBlock.h"
+#include "GetList.h"
+#include "customAssertion.h"
+#include "LinkedList.h"
+#include "Vector.h"
+#include "BitSet.h"
+#include "LcaIndex.h"
+#include "VersionMap.h"
+#include "VersionTree.h"
+#include "Arena.h"
+#include "Allocator.h"
+#include "ErrorObject.h"
+#include "CException.h"
+#include <stdlib.h>
+
+void setUp(void){}
+
+void tearDown(void){}
+
+/**
+ *       [A]                            [A]
+ *        |                            /   \
+ *       [B]     add A -> C     =>   [B]    |       imdDom(C) : B => A
+ *        |                           |     |       imdDom(D) : C => C
+ *       [C]                         [C] <--+
+ *        |                           |
+ *       [D]                         [D]
+ *
+ ***************************************************************************/
+void test_domUpdaterAddChild_should_move_the_affected_node_up_to_the_nca(void){
+  Node* nodeA = createNode(0);
+  Node* nodeB = createNode(1);
+  Node* nodeC = createNode(2);
+  Node* nodeD = createNode(3);
+
+  addChild(&nodeA, &nodeB);
+  addChild(&nodeB, &nodeC);
+  addChild(&nodeC, &nodeD);
+
+  DomUpdater* updater = createDomUpdater(&nodeA);
+  TEST_ASSERT_EQUAL_PTR(nodeB, nodeC->imdDom);
+  TEST_ASSERT_EQUAL(3, getDomLevel(updater, nodeD));
+
+  domUpdaterAddChild(updater, &nodeA, &nodeC);
+  TEST_ASSERT_EQUAL_PTR(nodeA, nodeC->imdDom);
+  TEST_ASSERT_EQUAL_PTR(nodeC, nodeD->imdDom);
+  TEST_ASSERT_EQUAL_PTR(nodeA, nodeB->imdDom);
+  TEST_ASSERT_EQUAL(1, getDomLevel(updater, nodeC));
+  TEST_ASSERT_EQUAL(2, getDomLevel(updater, nodeD));
+
+  /*  B lose C from its subtree, A gain nothing it does not dominate */
+  TEST_ASSERT_TRUE(isDomFrontierStale(updater, nodeB));
+  TEST_ASSERT_TRUE(isDomFrontierStale(updater, nodeA));
+  TEST_ASSERT_FALSE(isDomFrontierStale(updater, nodeD));
+
+  refreshDomFrontiers(updater);
+  TEST_ASSERT_EQUAL(1, nodeB->domFrontiers->length);
+  TEST_ASSERT_EQUAL_PTR(nodeC, nodeB->domFrontiers->item[0]);
+  TEST_ASSERT_EQUAL(0, nodeA->domFrontiers->length);
+  TEST_ASSERT_FALSE(isDomFrontierStale(updater, nodeB));
+
+  destroyDomUpdater(updater);
+  destroyCFG(nodeA);
+}
+
+/**
+ *       [A]                           [A]
+ *      /   \                           |
+ *    [B]   [C]    remove A -> C  =>   [B]        imdDom(D) : A => B
+ *      \   /                           |         C is not reached any more
+ *       [D]                           [D]
+ *
+ ***************************************************************************/
+void test_domUpdaterRemoveChild_should_redo_the_subtree_of_the_nca_only(void){
+  Node* nodeA = createNode(0);
+  Node* nodeB = createNode(1);
+  Node* nodeC = createNode(1);
+  Node* nodeD = createNode(2);
+
+  addChild(&nodeA, &nodeB);
+  addChild(&nodeA, &nodeC);
+  addChild(&nodeB, &nodeD);
+  addChild(&nodeC, &nodeD);
+
+  DomUpdater* updater = createDomUpdater(&nodeA);
+  TEST_ASSERT_EQUAL_PTR(nodeA, nodeD->imdDom);
+
+  domUpdaterRemoveChild(updater, &nodeA, &nodeC);
+  TEST_ASSERT_EQUAL_PTR(nodeB, nodeD->imdDom);
+  TEST_ASSERT_NULL(nodeC->imdDom);
+  TEST_ASSERT_EQUAL(NOT_REACHED, getDomLevel(updater, nodeC));
+  TEST_ASSERT_EQUAL(2, getDomLevel(updater, nodeD));
+
+  /*  adding the edge back reach C again */
+  domUpdaterAddChild(updater, &nodeA, &nodeC);
+  TEST_ASSERT_EQUAL_PTR(nodeA, nodeC->imdDom);
+  TEST_ASSERT_EQUAL_PTR(nodeA, nodeD->imdDom);
+  TEST_ASSERT_EQUAL(1, getDomLevel(updater, nodeD));
+
+  destroyDomUpdater(updater);
+  destroyCFG(nodeA);
+}
+
+void test_domUpdaterRemoveChild_given_no_edge_should_throw_ERR_NO_EDGE(void){
+  Node* nodeA = createNode(0);
+  Node* nodeB = createNode(1);
+  DomUpdater* updater = createDomUpdater(&nodeA);
+  ErrorObject* err;
+
+  Try{
+    domUpdaterRemoveChild(updater, &nodeA, &nodeB);
+    TEST_FAIL_MESSAGE("Expected ERR_NO_EDGE but none thrown");
+  }Catch(err){
+    TEST_ASSERT_EQUAL(ERR_NO_EDGE, err->errorCode);
+    freeError(err);
+  }
+  destroyDomUpdater(updater);
+  destroyNode(nodeA);
+  destroyNode(nodeB);
+}
+
+/*
+ *  The domFrontiers straight from the definition, a node v is in DF(w)
+ *  when w dominate a directDom of v but does not strictly dominate v
+ */
+static int isDominatedBy(Node* node, Node* domNode){
+  for(; node != NULL; node = node->imdDom)
+    if(node == domNode)
+      return 1;
+  return 0;
+}
+
+static int isInDomFrontiers(Node* node, Node* frontier, Node* rootNode){
+  int i;
+
+  if(node != frontier && isDominatedBy(frontier, node))
+    return 0;
+  for(i = 0; i < frontier->numOfDirectDom; i++)
+    if((frontier->directDom[i] == rootNode || frontier->directDom[i]->imdDom != NULL) && \
+        isDominatedBy(frontier->directDom[i], node))
+      return 1;
+  return 0;
+}
+
+#define NUM_OF_RANDOM_NODE  40
+
+/**
+ *  Random edges are added and removed through the DomUpdater, after
+ *  every change the imdDom must be the same as setAllImdDomSemiNCA give
+ *  from scratch and the refreshed domFrontiers the same as the definition
+ *
+ ***************************************************************************/
+void test_domUpdater_given_random_edits_should_match_a_full_recompute(void){
+  Node* node[NUM_OF_RANDOM_NODE];
+  Node* saved[NUM_OF_RANDOM_NODE];
+  Node *fromNode, *toNode;
+  Vector* order;
+  DomUpdater* updater;
+  int step, k, j, count, reached[NUM_OF_RANDOM_NODE];
+
+  srand(25);
+  for(k = 0; k < NUM_OF_RANDOM_NODE; k++)
+    node[k] = createNode(k);
+  for(k = 1; k < NUM_OF_RANDOM_NODE; k++)
+    if(rand() % 3)
+      addChild(&node[rand() % k], &node[k]);
+
+  updater = createDomUpdater(&node[0]);
+  for(k = 0; k < NUM_OF_RANDOM_NODE; k++)
+    if(getDomLevel(updater, node[k]) == NOT_REACHED)
+      node[k]->imdDom = NULL;
+  for(k = 0; k < NUM_OF_RANDOM_NODE; k++)
+    markDomFrontierStale(updater, node[k]);
+  refreshDomFrontiers(updater);
+
+  for(step = 0; step < 400; step++){
+    fromNode = node[rand() % NUM_OF_RANDOM_NODE];
+    if(fromNode->numOfChild > 0 && rand() % 2){
+      toNode = fromNode->children[rand() % fromNode->numOfChild];
+      domUpdaterRemoveChild(updater, &fromNode, &toNode);
+    }
+    else{
+      toNode = node[rand() % NUM_OF_RANDOM_NODE];
+      domUpdaterAddChild(updater, &fromNode, &toNode);
+    }
+
+    /*  imdDom against the full recompute */
+    for(k = 0; k < NUM_OF_RANDOM_NODE; k++)
+      saved[k] = node[k]->imdDom;
+    order = getNodeOrder(node[0], ORDER_RPO);
+    for(k = 0; k < NUM_OF_RANDOM_NODE; k++)
+      reached[k] = vectorFind(order, node[k]) >= 0;
+    setAllImdDomSemiNCA(&node[0]);
+    for(k = 0; k < NUM_OF_RANDOM_NODE; k++){
+      if(reached[k])
+        TEST_ASSERT_EQUAL_PTR(node[k]->imdDom, saved[k]);
+      else{
+        TEST_ASSERT_NULL(saved[k]);
+        TEST_ASSERT_EQUAL(NOT_REACHED, getDomLevel(updater, node[k]));
+      }
+      node[k]->imdDom = saved[k];
+    }
+
+    /*  domFrontiers against the definition */
+    refreshDomFrontiers(updater);
+    for(k = 0; k < NUM_OF_RANDOM_NODE; k++){
+      if(!reached[k])
+        continue;
+      for(j = 0, count = 0; j < NUM_OF_RANDOM_NODE; j++){
+        if(!reached[j] || !isInDomFrontiers(node[k], node[j], node[0]))
+          continue;
+        count++;
+        TEST_ASSERT_TRUE(vectorFind(node[k]->domFrontiers, node[j]) >= 0);
+      }
+      TEST_ASSERT_EQUAL(count, node[k]->domFrontiers->length);
+    }
+  }
+
+  destroyDomUpdater(updater);
+  for(k = 0; k < NUM_OF_RANDOM_NODE; k++)
+    destroyNode(node[k]);
+}
+
+#define NUM_OF_CHAIN_NODE  20000
+
+/**
+ *   [n0] -> [n1] -> [n2] -> ... -> [last]      add last -> n1
+ *            ^                       |
+ *            +-----------------------+
+ *
+ *  Every node from n1 down to last get n1 as its only domFrontiers, the
+ *  refresh must stay linear on such a deep dominator tree
+ *
+ ***************************************************************************/
+void test_refreshDomFrontiers_given_deep_chain_should_give_every_node_the_loop_entry(void){
+  Node** node = malloc(sizeof(Node*) * NUM_OF_CHAIN_NODE);
+  Node* lastNode;
+  DomUpdater* updater;
+  int k;
+
+  for(k = 0; k < NUM_OF_CHAIN_NODE; k++)
+    node[k] = createNode(k);
+  for(k = 1; k < NUM_OF_CHAIN_NODE; k++)
+    addChild(&node[k - 1], &node[k]);
+  lastNode = node[NUM_OF_CHAIN_NODE - 1];
+
+  updater = createDomUpdater(&node[0]);
+  domUpdaterAddChild(updater, &lastNode, &node[1]);
+  TEST_ASSERT_EQUAL_PTR(node[NUM_OF_CHAIN_NODE - 2], lastNode->imdDom);
+  for(k = 0; k < NUM_OF_CHAIN_NODE; k++)
+    markDomFrontierStale(updater, node[k]);
+  refreshDomFrontiers(updater);
+
+  TEST_ASSERT_EQUAL(0, node[0]->domFrontiers->length);
+  for(k = 1; k < NUM_OF_CHAIN_NODE; k++){
+    TEST_ASSERT_EQUAL(1, node[k]->domFrontiers->length);
+    TEST_ASSERT_EQUAL_PTR(node[1], node[k]->domFrontiers->item[0]);
+  }
+
+  destroyDomUpdater(updater);
+  for(k = 0; k < NUM_OF_CHAIN_NODE; k++)
+    destroyNode(node[k]);
+  free(node);
+}
+
+void test_createDomUpdater_given_NULL_should_throw_ERR_NULL_NODE(void){
+  Node* nodeA = NULL;
+  ErrorObject* err;
+  Try{
+    createDomUpdater(&nodeA);
+    TEST_FAIL_MESSAGE("Expected ERR_NULL_NODE but none thrown");
+  }Catch(err){
+    TEST_ASSERT_EQUAL(ERR_NULL_NODE, err->errorCode);
+    freeError(err);
+  }
+}
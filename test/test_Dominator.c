@@ -0,0 +1,524 @@
+#include "unity.h"
+#include "Dominator.h"
+#include "NodeChain.h"
+#include "ExpressionBlock.h"
+#include "GetList.h"
+#include "customAssertion.h"
+#include "LinkedList.h"
+#include "Vector.h"
+#include "BitSet.h"
+#include "LcaIndex.h"
+#include "VersionMap.h"
+#include "VersionTree.h"
+#include "Arena.h"
+#include "Allocator.h"
+#include "ErrorObject.h"
+#include "CException.h"
+#include <stdlib.h>
+
+void setUp(void){}
+
+void tearDown(void){}
+
+/**
+ *  getReversePostorder
+ *
+ *      [A]
+ *     /   \
+ *   [B]   [C]       RPO = A, C, B, D
+ *     \   /
+ *      [D]
+ *
+ ***************************************************************************/
+void test_getReversePostorder_should_put_every_node_before_its_successor(void){
+  Node* nodeA = createNode(0);
+  Node* nodeB = createNode(1);
+  Node* nodeC = createNode(1);
+  Node* nodeD = createNode(2);
+
+  addChild(&nodeA, &nodeB);
+  addChild(&nodeA, &nodeC);
+  addChild(&nodeB, &nodeD);
+  addChild(&nodeC, &nodeD);
+
+  Vector* testList     = getReversePostorder(&nodeA);
+  Vector* expectedList = createVector(0);
+  vectorAddLast(expectedList, nodeA);
+  vectorAddLast(expectedList, nodeC);
+  vectorAddLast(expectedList, nodeB);
+  vectorAddLast(expectedList, nodeD);
+
+  TEST_ASSERT_VECTOR(expectedList, testList);
+}
+
+/**
+ *  getNodeOrder
+ *  The order is kept inside the root until an edge change, then it is
+ *  built again with the new edge
+ *
+ *      [A]
+ *     /   \
+ *   [B]   [C]       RPO = A, C, B, D       PO = D, B, C, A
+ *     \   /
+ *      [D] -> [E]   after addChild(D, E)
+ *
+ ***************************************************************************/
+void test_getNodeOrder_should_keep_the_order_until_an_edge_change(void){
+  Node* nodeA = createNode(0);
+  Node* nodeB = createNode(1);
+  Node* nodeC = createNode(1);
+  Node* nodeD = createNode(2);
+  Node* nodeE = createNode(3);
+
+  addChild(&nodeA, &nodeB);
+  addChild(&nodeA, &nodeC);
+  addChild(&nodeB, &nodeD);
+  addChild(&nodeC, &nodeD);
+
+  Vector* rpoList = getNodeOrder(nodeA, ORDER_RPO);
+  Vector* poList  = getNodeOrder(nodeA, ORDER_PO);
+  Vector* expectedList = createVector(0);
+  vectorAddLast(expectedList, nodeD);
+  vectorAddLast(expectedList, nodeB);
+  vectorAddLast(expectedList, nodeC);
+  vectorAddLast(expectedList, nodeA);
+
+  TEST_ASSERT_VECTOR(expectedList, poList);
+  TEST_ASSERT_EQUAL(4, rpoList->length);
+  TEST_ASSERT_EQUAL_PTR(nodeC, rpoList->item[1]);
+  TEST_ASSERT_EQUAL_PTR(rpoList, getNodeOrder(nodeA, ORDER_RPO));
+  TEST_ASSERT_EQUAL_PTR(poList, getNodeOrder(nodeA, ORDER_PO));
+
+  addChild(&nodeD, &nodeE);
+  rpoList = getNodeOrder(nodeA, ORDER_RPO);
+
+  TEST_ASSERT_EQUAL(5, rpoList->length);
+  TEST_ASSERT_EQUAL_PTR(nodeE, rpoList->item[4]);
+  TEST_ASSERT_EQUAL(5, getNodeOrder(nodeA, ORDER_RANK)->length);
+
+  destroyVector(expectedList);
+  destroyCFG(nodeA);
+}
+
+/**
+ *  getNodeOrder
+ *  An edge change in one CFG does not throw away the order of another
+ *
+ *    [A] -> [B]          [C] -> [D]   after addChild(C, D)
+ *
+ ***************************************************************************/
+void test_getNodeOrder_given_edge_change_in_another_CFG_should_keep_the_order(void){
+  Node* nodeA = createNode(0);
+  Node* nodeB = createNode(1);
+  Node* nodeC = createNode(0);
+  Node* nodeD = createNode(1);
+
+  addChild(&nodeA, &nodeB);
+  Vector* rpoList = getNodeOrder(nodeA, ORDER_RPO);
+
+  addChild(&nodeC, &nodeD);
+  TEST_ASSERT_EQUAL_PTR(rpoList, getNodeOrder(nodeA, ORDER_RPO));
+  TEST_ASSERT_EQUAL(2, getNodeOrder(nodeC, ORDER_RPO)->length);
+
+  removeChild(&nodeA, &nodeB);
+  TEST_ASSERT_EQUAL(1, getNodeOrder(nodeA, ORDER_RPO)->length);
+
+  destroyNode(nodeB);
+  destroyCFG(nodeA);
+  destroyCFG(nodeC);
+}
+
+/**
+ *  getNodeOrder
+ *  A CFG built with malloc get its order kept inside a compile session,
+ *  the order came from the Arena and must not be given back to malloc
+ *  once the session ended
+ *
+ ***************************************************************************/
+void test_getNodeOrder_given_order_kept_inside_a_session_should_drop_it_after(void){
+  Node* nodeA = createNode(0);
+  Node* nodeB = createNode(1);
+  Node* nodeC = createNode(2);
+
+  addChild(&nodeA, &nodeB);
+  getNodeOrder(nodeA, ORDER_RPO);
+
+  beginCompileSession();
+  TEST_ASSERT_EQUAL(2, getNodeOrder(nodeA, ORDER_RPO)->length);
+  TEST_ASSERT_EQUAL(2, getNodeOrder(nodeA, ORDER_PO)->length);
+  endCompileSession();
+
+  addChild(&nodeB, &nodeC);
+  TEST_ASSERT_EQUAL(3, getNodeOrder(nodeA, ORDER_RPO)->length);
+  TEST_ASSERT_EQUAL_PTR(nodeC, getNodeOrder(nodeA, ORDER_PO)->item[0]);
+
+  destroyCFG(nodeA);
+}
+
+/**
+ *  setAllImdDomIterative
+ *
+ *          | Entry
+ *         \/
+ *        [ A ]<<<<                 imdDom(A) = NULL
+ *       |   |    /\                imdDom(B) = A
+ *      \/  \/    /\                imdDom(C) = A
+ *     [B]  [C]   /\                imdDom(D) = A
+ *      |    |    /\
+ *     \/   \/    /\
+ *       [D] >>>>>>>
+ *
+ ***************************************************************************/
+void test_setAllImdDomIterative_given_CFG1_should_set_imdDom(void){
+  Node* nodeA = createNode(0);
+  Node* nodeB = createNode(1);
+  Node* nodeC = createNode(1);
+  Node* nodeD = createNode(2);
+
+  addChild(&nodeA, &nodeB);
+  addChild(&nodeA, &nodeC);
+  addChild(&nodeB, &nodeD);
+  addChild(&nodeC, &nodeD);
+  addChild(&nodeD, &nodeA);
+
+  setAllImdDomIterative(&nodeA);
+
+  TEST_ASSERT_NULL(nodeA->imdDom);
+  TEST_ASSERT_EQUAL_PTR(nodeA, nodeB->imdDom);
+  TEST_ASSERT_EQUAL_PTR(nodeA, nodeC->imdDom);
+  TEST_ASSERT_EQUAL_PTR(nodeA, nodeD->imdDom);
+}
+
+/**
+ *  setAllImdDomIterative
+ *  The rank given below does not follow the dominance, the result
+ *  should only depend on the edges
+ *
+ *     [A] rank 0                   imdDom(B) = A
+ *      |  \                        imdDom(C) = B
+ *     [B]  \  rank 5               imdDom(D) = A
+ *      |    |                      imdDom(E) = D
+ *     [C]   |  rank 1
+ *       \   |
+ *        [D]   rank 1
+ *         |
+ *        [E]   rank 0
+ *
+ ***************************************************************************/
+void test_setAllImdDomIterative_should_not_depend_on_rank(void){
+  Node* nodeA = createNode(0);
+  Node* nodeB = createNode(5);
+  Node* nodeC = createNode(1);
+  Node* nodeD = createNode(1);
+  Node* nodeE = createNode(0);
+
+  addChild(&nodeA, &nodeB);
+  addChild(&nodeA, &nodeD);
+  addChild(&nodeB, &nodeC);
+  addChild(&nodeC, &nodeD);
+  addChild(&nodeD, &nodeE);
+
+  setAllImdDomIterative(&nodeA);
+
+  TEST_ASSERT_NULL(nodeA->imdDom);
+  TEST_ASSERT_EQUAL_PTR(nodeA, nodeB->imdDom);
+  TEST_ASSERT_EQUAL_PTR(nodeB, nodeC->imdDom);
+  TEST_ASSERT_EQUAL_PTR(nodeA, nodeD->imdDom);
+  TEST_ASSERT_EQUAL_PTR(nodeD, nodeE->imdDom);
+}
+
+/**
+ *  setAllImdDomIterative
+ *  Irreducible graph of figure 4 in Cooper, Harvey and Kennedy, the loop
+ *  has two entries so nothing inside it dominate another
+ *
+ *            [6]
+ *           /   \
+ *         [5]   [4]
+ *          |    / \
+ *         [1]<->[2]<->[3]          imdDom of 1 .. 5 = 6
+ *
+ ***************************************************************************/
+void test_setAllImdDomIterative_given_irreducible_loop_should_set_imdDom_to_entry(void){
+  Node* node6 = createNode(0);
+  Node* node5 = createNode(1);
+  Node* node4 = createNode(1);
+  Node* node1 = createNode(2);
+  Node* node2 = createNode(2);
+  Node* node3 = createNode(2);
+
+  addChild(&node6, &node5);
+  addChild(&node6, &node4);
+  addChild(&node5, &node1);
+  addChild(&node4, &node2);
+  addChild(&node4, &node3);
+  addChild(&node1, &node2);
+  addChild(&node2, &node1);
+  addChild(&node2, &node3);
+  addChild(&node3, &node2);
+
+  setAllImdDomIterative(&node6);
+
+  TEST_ASSERT_NULL(node6->imdDom);
+  TEST_ASSERT_EQUAL_PTR(node6, node1->imdDom);
+  TEST_ASSERT_EQUAL_PTR(node6, node2->imdDom);
+  TEST_ASSERT_EQUAL_PTR(node6, node3->imdDom);
+  TEST_ASSERT_EQUAL_PTR(node6, node4->imdDom);
+  TEST_ASSERT_EQUAL_PTR(node6, node5->imdDom);
+}
+
+void test_setAllImdDomIterative_given_NULL_should_throw_ERR_NULL_NODE(void){
+  Node* nodeA = NULL;
+  ErrorObject* err;
+  Try{
+    setAllImdDomIterative(&nodeA);
+    TEST_FAIL_MESSAGE("Expected ERR_NULL_NODE but none thrown");
+  }Catch(err){
+    TEST_ASSERT_EQUAL(ERR_NULL_NODE, err->errorCode);
+    freeError(err);
+  }
+  Try{
+    setAllImdDomIterative(NULL);
+    TEST_FAIL_MESSAGE("Expected ERR_NULL_NODE but none thrown");
+  }Catch(err){
+    TEST_ASSERT_EQUAL(ERR_NULL_NODE, err->errorCode);
+    freeError(err);
+  }
+}
+
+void test_setAllImdDomSemiNCA_given_NULL_should_throw_ERR_NULL_NODE(void){
+  Node* nodeA = NULL;
+  ErrorObject* err;
+  Try{
+    setAllImdDomSemiNCA(&nodeA);
+    TEST_FAIL_MESSAGE("Expected ERR_NULL_NODE but none thrown");
+  }Catch(err){
+    TEST_ASSERT_EQUAL(ERR_NULL_NODE, err->errorCode);
+    freeError(err);
+  }
+  Try{
+    setAllImdDomSemiNCA(NULL);
+    TEST_FAIL_MESSAGE("Expected ERR_NULL_NODE but none thrown");
+  }Catch(err){
+    TEST_ASSERT_EQUAL(ERR_NULL_NODE, err->errorCode);
+    freeError(err);
+  }
+}
+
+/**
+ *  setAllImdDomSemiNCA
+ *  Same CFG as the irreducible test above
+ *
+ ***************************************************************************/
+void test_setAllImdDomSemiNCA_given_irreducible_loop_should_set_imdDom_to_entry(void){
+  Node* node6 = createNode(0);
+  Node* node5 = createNode(1);
+  Node* node4 = createNode(1);
+  Node* node1 = createNode(2);
+  Node* node2 = createNode(2);
+  Node* node3 = createNode(2);
+
+  addChild(&node6, &node5);
+  addChild(&node6, &node4);
+  addChild(&node5, &node1);
+  addChild(&node4, &node2);
+  addChild(&node4, &node3);
+  addChild(&node1, &node2);
+  addChild(&node2, &node1);
+  addChild(&node2, &node3);
+  addChild(&node3, &node2);
+
+  setAllImdDomSemiNCA(&node6);
+
+  TEST_ASSERT_NULL(node6->imdDom);
+  TEST_ASSERT_EQUAL_PTR(node6, node1->imdDom);
+  TEST_ASSERT_EQUAL_PTR(node6, node2->imdDom);
+  TEST_ASSERT_EQUAL_PTR(node6, node3->imdDom);
+  TEST_ASSERT_EQUAL_PTR(node6, node4->imdDom);
+  TEST_ASSERT_EQUAL_PTR(node6, node5->imdDom);
+}
+
+/**
+ *  setAllImdDomSemiNCA
+ *  Same CFG as the rank test above
+ *
+ ***************************************************************************/
+void test_setAllImdDomSemiNCA_should_not_depend_on_rank(void){
+  Node* nodeA = createNode(0);
+  Node* nodeB = createNode(5);
+  Node* nodeC = createNode(1);
+  Node* nodeD = createNode(1);
+  Node* nodeE = createNode(0);
+
+  addChild(&nodeA, &nodeB);
+  addChild(&nodeA, &nodeD);
+  addChild(&nodeB, &nodeC);
+  addChild(&nodeC, &nodeD);
+  addChild(&nodeD, &nodeE);
+
+  setAllImdDomSemiNCA(&nodeA);
+
+  TEST_ASSERT_NULL(nodeA->imdDom);
+  TEST_ASSERT_EQUAL_PTR(nodeA, nodeB->imdDom);
+  TEST_ASSERT_EQUAL_PTR(nodeB, nodeC->imdDom);
+  TEST_ASSERT_EQUAL_PTR(nodeA, nodeD->imdDom);
+  TEST_ASSERT_EQUAL_PTR(nodeD, nodeE->imdDom);
+}
+
+/**
+ *  setAllImdDomSemiNCA / setAllImdDomIterative
+ *  A chain of 100000 diamond, every diamond loop back to the head of the
+ *  one before it. Neither of them should run out of stack and both should
+ *  give the same imdDom
+ *
+ *     [head_i]  <--------------+
+ *      /    \                  |
+ *  [left_i] [right_i]          |
+ *      \    /                  |
+ *     [head_i+1] --------------+
+ *
+ ***************************************************************************/
+void test_setAllImdDomSemiNCA_given_deep_CFG_should_match_setAllImdDomIterative(void){
+  int i, numOfDiamond = 100000;
+  Node** head   = malloc(sizeof(Node*) * (numOfDiamond + 1));
+  Node** left   = malloc(sizeof(Node*) * numOfDiamond);
+  Node** right  = malloc(sizeof(Node*) * numOfDiamond);
+  Node** expect = malloc(sizeof(Node*) * numOfDiamond);
+
+  head[0] = createNode(0);
+  for(i = 0; i < numOfDiamond; i++){
+    left[i]     = createNode(2 * i + 1);
+    right[i]    = createNode(2 * i + 1);
+    head[i + 1] = createNode(2 * i + 2);
+    addChild(&head[i], &left[i]);
+    addChild(&head[i], &right[i]);
+    addChild(&left[i], &head[i + 1]);
+    addChild(&right[i], &head[i + 1]);
+    addChild(&head[i + 1], &head[i]);
+  }
+
+  setAllImdDomIterative(&head[0]);
+  for(i = 0; i < numOfDiamond; i++)
+    expect[i] = head[i + 1]->imdDom;
+
+  setAllImdDomSemiNCA(&head[0]);
+  for(i = 0; i < numOfDiamond; i++){
+    TEST_ASSERT_EQUAL_PTR(head[i], expect[i]);
+    TEST_ASSERT_EQUAL_PTR(expect[i], head[i + 1]->imdDom);
+    TEST_ASSERT_EQUAL_PTR(head[i], left[i]->imdDom);
+  }
+
+  destroyCFG(head[0]);
+  free(head);
+  free(left);
+  free(right);
+  free(expect);
+}
+
+/**
+ *  getAllDomFrontiers
+ *  On the same chain of 100000 diamond, DF(left) = DF(right) = { next head }
+ *  and the head of every diamond is in the domFrontiers of the next head
+ *
+ ***************************************************************************/
+void test_getAllDomFrontiers_given_deep_CFG_should_give_domFrontiers_of_every_node(void){
+  int i, numOfDiamond = 100000;
+  Node** head   = malloc(sizeof(Node*) * (numOfDiamond + 1));
+  Node** left   = malloc(sizeof(Node*) * numOfDiamond);
+  Node** right  = malloc(sizeof(Node*) * numOfDiamond);
+
+  head[0] = createNode(0);
+  for(i = 0; i < numOfDiamond; i++){
+    left[i]     = createNode(2 * i + 1);
+    right[i]    = createNode(2 * i + 1);
+    head[i + 1] = createNode(2 * i + 2);
+    addChild(&head[i], &left[i]);
+    addChild(&head[i], &right[i]);
+    addChild(&left[i], &head[i + 1]);
+    addChild(&right[i], &head[i + 1]);
+    addChild(&head[i + 1], &head[i]);
+  }
+
+  setAllImdDomIterative(&head[0]);
+  Vector* unionDomFrontiers = getAllDomFrontiers(&head[0]);
+
+  TEST_ASSERT_EQUAL(numOfDiamond + 1, unionDomFrontiers->length);
+  for(i = 0; i < numOfDiamond; i++){
+    TEST_ASSERT_EQUAL(1, left[i]->domFrontiers->length);
+    TEST_ASSERT_EQUAL_PTR(head[i + 1], left[i]->domFrontiers->item[0]);
+    TEST_ASSERT_EQUAL_PTR(head[i + 1], right[i]->domFrontiers->item[0]);
+    TEST_ASSERT_EQUAL_PTR(head[i], head[i + 1]->domFrontiers->item[0]);
+  }
+
+  destroyVector(unionDomFrontiers);
+  destroyCFG(head[0]);
+  free(head);
+  free(left);
+  free(right);
+}
+
+/**
+ *  setAllImdDomWith
+ *  DOM_LAST_BRANCH should give the same imdDom as setLastBrhDom and
+ *  setAllImdDom on the CFG1 above
+ *
+ ***************************************************************************/
+void test_setAllImdDomWith_should_select_the_algorithm(void){
+  DomAlgorithm algorithm[] = {DOM_LAST_BRANCH, DOM_ITERATIVE, DOM_SEMI_NCA};
+  int i;
+
+  for(i = 0; i < 3; i++){
+    Node* nodeA = createNode(0);
+    Node* nodeB = createNode(1);
+    Node* nodeC = createNode(1);
+    Node* nodeD = createNode(2);
+
+    addChild(&nodeA, &nodeB);
+    addChild(&nodeA, &nodeC);
+    addChild(&nodeB, &nodeD);
+    addChild(&nodeC, &nodeD);
+
+    setAllImdDomWith(&nodeA, algorithm[i]);
+
+    TEST_ASSERT_NULL(nodeA->imdDom);
+    TEST_ASSERT_EQUAL_PTR(nodeA, nodeB->imdDom);
+    TEST_ASSERT_EQUAL_PTR(nodeA, nodeC->imdDom);
+    TEST_ASSERT_EQUAL_PTR(nodeA, nodeD->imdDom);
+  }
+}
+
+/**
+ *  A small CFG made after many other nodes, the dominators must not take
+ *  scratch space for the nodes made before it
+ */
+void test_setAllImdDom_given_many_older_nodes_should_size_scratch_by_the_CFG(void){
+  DomAlgorithm algorithm[] = {DOM_ITERATIVE, DOM_SEMI_NCA};
+  MemoryStats listStats;
+  Node* oldNode;
+  int i, k;
+
+  for(k = 0; k < 100000; k++){
+    oldNode = createNode(0);
+    destroyNode(oldNode);
+  }
+
+  for(i = 0; i < 2; i++){
+    Node* nodeA = createNode(0);
+    Node* nodeB = createNode(1);
+    Node* nodeC = createNode(1);
+    Node* nodeD = createNode(2);
+
+    addChild(&nodeA, &nodeB);
+    addChild(&nodeA, &nodeC);
+    addChild(&nodeB, &nodeD);
+    addChild(&nodeC, &nodeD);
+
+    resetMemoryStats();
+    setAllImdDomWith(&nodeA, algorithm[i]);
+    listStats = getMemoryStats(MEM_LIST);
+
+    TEST_ASSERT_EQUAL_PTR(nodeA, nodeD->imdDom);
+    TEST_ASSERT_TRUE(listStats.bytesAlloc < 8 * 1024);
+    destroyCFG(nodeA);
+  }
+}
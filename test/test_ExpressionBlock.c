@@ -2,6 +2,13 @@
 #include "ExpressionBlock.h"
 #include "GetList.h"
 #include "LinkedList.h"
+#include "Vector.h"
+#include "BitSet.h"
+#include "LcaIndex.h"
+#include "VersionMap.h"
+#include "VersionTree.h"
+#include "Arena.h"
+#include "Allocator.h"
 #include "ErrorObject.h"
 #include "customAssertion.h"
 #include "NodeChain.h"
@@ -193,7 +200,7 @@ void test_assignAllNodeSSA_with_only_x(void){
 
   setLastBrhDom(&nodeA);
   
-  assignAllNodeSSA(nodeA, createLinkedList(), createLinkedList());
+  assignAllNodeSSA(nodeA, createVersionMap(0), NULL);
   ListElement* testExp = nodeA->block->head;
   
   TEST_ASSERT_SUBSCRIPT(x, 0, &((Expression*)testExp->node)->id);
@@ -243,7 +250,7 @@ void test_assignAllNodeSSA_with_muliple_variable(void){
 
   setLastBrhDom(&nodeA);
 
-  assignAllNodeSSA(nodeA, createLinkedList(), createLinkedList());
+  assignAllNodeSSA(nodeA, createVersionMap(0), NULL);
 
   ListElement* testExp = nodeA->block->head;
   TEST_ASSERT_SUBSCRIPT(x, 0, &((Expression*)testExp->node)->id);
@@ -306,7 +313,7 @@ void test_assignAllNodeSSA_with_muliple_Node(void){
 
   setLastBrhDom(&nodeA);
   
-  assignAllNodeSSA(nodeA, createLinkedList(), createLinkedList());
+  assignAllNodeSSA(nodeA, createVersionMap(0), NULL);
   ListElement* testExp = nodeA->block->head;
   TEST_ASSERT_SUBSCRIPT(x, 0, &((Expression*)testExp->node)->id);
   TEST_ASSERT_SUBSCRIPT(4, 0, &((Expression*)testExp->node)->oprdA);
@@ -330,6 +337,44 @@ void test_assignAllNodeSSA_with_muliple_Node(void){
   TEST_ASSERT_SUBSCRIPT(x, 0, &((Expression*)testExp->node)->oprdB);
 }
 
+/**
+ *  assignAllNodeSSA
+ *
+ *  Same CFG as above, the VersionTree every node derive for its children
+ *  is given back, so nothing of the list memory is left once the CFG and
+ *  the updtList are destroyed
+ *
+ *************************************************************************/
+void test_assignAllNodeSSA_should_give_back_every_VersionTree(void){
+  Node *nodeA, *nodeB, *nodeC, *nodeD;
+  VersionMap* updtList;
+  MemoryStats listStats;
+
+  resetMemoryStats();
+  nodeA = createNode(0);
+  nodeB = createNode(1);
+  nodeC = createNode(1);
+  nodeD = createNode(2);
+  addChild(&nodeA, &nodeB);
+  addChild(&nodeA, &nodeC);
+  addChild(&nodeB, &nodeD);
+  addChild(&nodeC, &nodeD);
+  addListLast(nodeA->block, createExpression(x, ASSIGN, 4, 0, 0));
+  addListLast(nodeA->block, createExpression(y, ASSIGN, 5, 0, 0));
+  addListLast(nodeB->block, createExpression(x, MULTIPLICATION, x, y, 0));
+  addListLast(nodeC->block, createExpression(y, ADDITION, x, x, 0));
+  addListLast(nodeD->block, createExpression(x, ADDITION, x, y, 0));
+
+  setLastBrhDom(&nodeA);
+  updtList = createVersionMap(0);
+  assignAllNodeSSA(nodeA, updtList, NULL);
+  destroyVersionMap(updtList);
+  destroyCFG(nodeA);
+
+  listStats = getMemoryStats(MEM_LIST);
+  TEST_ASSERT_EQUAL(listStats.bytesAlloc, listStats.bytesFreed);
+}
+
 /**
  *  assignAllNodeSSA
  *
@@ -358,7 +403,7 @@ void test_assignAllNodeSSA_should_Throw_ERR_UNDECLARE_VARIABLE(void){
     addListLast(nodeB->block, exp3);
     setLastBrhDom(&nodeA);
   
-    assignAllNodeSSA(nodeA, createLinkedList(), createLinkedList());
+    assignAllNodeSSA(nodeA, createVersionMap(0), NULL);
     TEST_FAIL_MESSAGE("Expected ERR_UNDECLARE_VARIABLE but not error thrown")
   } Catch(err){
     TEST_ASSERT_EQUAL(ERR_UNDECLARE_VARIABLE, err->errorCode);
@@ -391,7 +436,7 @@ void test_assignAllNodeSSA_should_not_change_thing_in_NodeB(void){
   addListLast(nodeA->block, exp2);
   addListLast(nodeB->block, exp3);
   setLastBrhDom(&nodeA); 
-  assignAllNodeSSA(nodeA, createLinkedList(), createLinkedList());
+  assignAllNodeSSA(nodeA, createVersionMap(0), NULL);
   
   LinkedList* testList = nodeB->block;
   ListElement* testPtr = testList->head;
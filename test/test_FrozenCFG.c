@@ -0,0 +1,337 @@
+#include "unity.h"
+#include "FrozenCFG.h"
+#include "PhiFunction.h"
+#include "NodeChain.h"
+#include "ExpressionBlock.h"
+#include "GetList.h"
+#include "customAssertion.h"
+#include "LinkedList.h"
+#include "Vector.h"
+#include "BitSet.h"
+#include "LcaIndex.h"
+#include "VersionMap.h"
+#include "VersionTree.h"
+#include "Arena.h"
+#include "Allocator.h"
+#include "ErrorObject.h"
+#include "CException.h"
+#include <stdlib.h>
+
+int x = 120;
+int a = 97;
+
+void setUp(void){}
+
+void tearDown(void){}
+
+/**
+ *  freezeCFG
+ *
+ *      (A)          block   succ      pred
+ *     /   \           A     B, C      -
+ *   (B)   (C)         B     D         A
+ *     \   /           C     D         A
+ *      (D)            D     -         B, C
+ *
+ ***************************************************************************/
+void test_freezeCFG_should_pack_successor_and_predecessor_into_CSR(void){
+  Node* nodeA = createNode(0);
+  Node* nodeB = createNode(1);
+  Node* nodeC = createNode(1);
+  Node* nodeD = createNode(2);
+
+  addChild(&nodeA, &nodeB);
+  addChild(&nodeA, &nodeC);
+  addChild(&nodeB, &nodeD);
+  addChild(&nodeC, &nodeD);
+
+  FrozenCFG* cfg = freezeCFG(&nodeA);
+  int expectSuccStart[] = {0, 2, 3, 4, 4};
+  int expectSucc[]      = {1, 2, 3, 3};
+  int expectPredStart[] = {0, 0, 1, 2, 4};
+  int expectPred[]      = {0, 0, 1, 2};
+  int expectRank[]      = {0, 1, 1, 2};
+
+  TEST_ASSERT_EQUAL(4, cfg->numOfBlock);
+  TEST_ASSERT_EQUAL(4, cfg->numOfEdge);
+  TEST_ASSERT_EQUAL_PTR(nodeA, cfg->node[0]);
+  TEST_ASSERT_EQUAL_PTR(nodeD, cfg->node[3]);
+  TEST_ASSERT_EQUAL_INT_ARRAY(expectSuccStart, cfg->succStart, 5);
+  TEST_ASSERT_EQUAL_INT_ARRAY(expectSucc, cfg->succ, 4);
+  TEST_ASSERT_EQUAL_INT_ARRAY(expectPredStart, cfg->predStart, 5);
+  TEST_ASSERT_EQUAL_INT_ARRAY(expectPred, cfg->pred, 4);
+  TEST_ASSERT_EQUAL_INT_ARRAY(expectRank, cfg->rank, 4);
+  TEST_ASSERT_EQUAL(NO_BLOCK, cfg->parent[0]);
+  TEST_ASSERT_EQUAL(2, cfg->parent[3]);
+  destroyFrozenCFG(cfg);
+}
+
+void test_freezeCFG_given_NULL_should_throw_ERR_NULL_NODE(void){
+  Node* nodeA = NULL;
+  ErrorObject* err;
+  Try{
+    freezeCFG(&nodeA);
+    TEST_FAIL_MESSAGE("Expected ERR_NULL_NODE but none thrown");
+  }Catch(err){
+    TEST_ASSERT_EQUAL(ERR_NULL_NODE, err->errorCode);
+    freeError(err);
+  }
+}
+
+/**
+ *  frozenSetLastBrhDom / frozenSetAllImdDom / frozenGetAllDomFrontiers
+ *
+ *          | Entry                 DF(A) = { A }
+ *         \/                       DF(B) = { D }
+ *        [ A ]<<<<                 DF(C) = { D }
+ *       |   |    /\                DF(D) = { A }
+ *      \/  \/    /\                UDF = { A , D}
+ *     [B]  [C]   /\
+ *      |    |    /\
+ *     \/   \/    /\
+ *       [D] >>>>>>>
+ *
+ *  The frozen view should give the same dominator and domFrontiers as
+ *  the Node functions and write them back to the Node
+ *
+ ***************************************************************************/
+void test_frozenGetAllDomFrontiers_given_CFG1_should_give_a_union_of_dominatorFrontiers_list(void){
+  Node* nodeA = createNode(0);
+  Node* nodeB = createNode(1);
+  Node* nodeC = createNode(1);
+  Node* nodeD = createNode(2);
+
+  addChild(&nodeA, &nodeB);
+  addChild(&nodeA, &nodeC);
+  addChild(&nodeB, &nodeD);
+  addChild(&nodeC, &nodeD);
+  addChild(&nodeD, &nodeA);
+
+  FrozenCFG* cfg = freezeCFG(&nodeA);
+  frozenSetLastBrhDom(cfg);
+  frozenSetAllImdDom(cfg);
+  Vector* unionDomFrontiers = frozenGetAllDomFrontiers(cfg);
+
+  Vector* expectUnionDomFrontiers = createVector(0);
+  vectorAddLast(expectUnionDomFrontiers, nodeA);
+  vectorAddLast(expectUnionDomFrontiers, nodeD);
+
+  TEST_ASSERT_VECTOR(expectUnionDomFrontiers, unionDomFrontiers);
+  TEST_ASSERT_EQUAL_PTR(nodeA, nodeD->lastBrhDom);
+  TEST_ASSERT_EQUAL_PTR(nodeA, nodeD->imdDom);
+  TEST_ASSERT_EQUAL_PTR(nodeA, nodeB->imdDom);
+  TEST_ASSERT_EQUAL(1, nodeB->domFrontiers->length);
+  TEST_ASSERT_EQUAL_PTR(nodeD, nodeB->domFrontiers->item[0]);
+  TEST_ASSERT_EQUAL(0, cfg->imdDom[1]);
+  destroyFrozenCFG(cfg);
+}
+
+/**
+ *  frozenAssignAllNodeSSA / frozenAllocPhiFunc
+ *
+ *       [A](x0)
+ *      /   \
+ *     \/   \/
+ *(x1)[B]   [C](x4)
+ *     |     |
+ *     \/   \/
+ *       [D]    <=  (x2) = PhiFunction(x4,x1,a)
+ *
+ *  The whole SSA construction on the frozen view should place the same
+ *  phiFunction in D as the Node functions do
+ *
+ ***************************************************************************/
+void test_frozenAllocPhiFunc_allocation_after_frozenAssignAllNodeSSA(void){
+  Node* nodeA = createNode(0);
+  Node* nodeB = createNode(1);
+  Node* nodeC = createNode(1);
+  Node* nodeD = createNode(2);
+  addListLast(nodeA->block, createExpression(x, ASSIGN, 14, 0, 0));
+  addListLast(nodeA->block, createExpression(a, EQUAL_TO, x, x, 0));
+  addListLast(nodeA->block, createExpression(0, IF_STATEMENT, a, (int)&nodeC, 0));
+  addListLast(nodeB->block, createExpression(x, ADDITION, x, x, 0));
+  addListLast(nodeC->block, createExpression(x, MULTIPLICATION, x, x, 0));
+  addListLast(nodeD->block, createExpression(x, ADDITION, x, x, 0));
+
+  addChild(&nodeA, &nodeB);
+  addChild(&nodeA, &nodeC);
+  addChild(&nodeB, &nodeD);
+  addChild(&nodeC, &nodeD);
+
+  FrozenCFG* cfg = freezeCFG(&nodeA);
+  frozenSetLastBrhDom(cfg);
+  frozenAssignAllNodeSSA(cfg, createVersionMap(0), NULL);
+  frozenAllocPhiFunc(cfg);
+
+  TEST_ASSERT_EQUAL(2, nodeD->numOfDirectDom);
+  TEST_ASSERT_EQUAL_PTR(nodeB, nodeD->directDom[0]);
+  TEST_ASSERT_EQUAL_PTR(nodeC, nodeD->directDom[1]);
+  TEST_ASSERT_EQUAL(3, nodeA->block->length);
+  TEST_ASSERT_EQUAL(1, nodeB->block->length);
+  TEST_ASSERT_EQUAL(1, nodeC->block->length);
+  TEST_ASSERT_EQUAL(2, nodeD->block->length);
+
+  Expression* testPhi = createExpression(x, PHI_FUNC, x, x, a);
+  testPhi->id.index    = 2;
+  testPhi->oprdA.index = 4;
+  testPhi->oprdB.index = 1;
+  TEST_ASSERT_PHIFUNC(testPhi, &nodeD);
+  destroyFrozenCFG(cfg);
+}
+
+/**
+ *  The frozen passes keep their visit on the block arrays, a visit the
+ *  Node functions started before is left as it is
+ *
+ ***************************************************************************/
+void test_frozen_passes_should_not_mark_the_Node_visited(void){
+  Node* nodeA = createNode(0);
+  Node* nodeB = createNode(1);
+  Node* nodeC = createNode(1);
+  Node* nodeD = createNode(2);
+  addListLast(nodeA->block, createExpression(x, ASSIGN, 14, 0, 0));
+  addListLast(nodeA->block, createExpression(a, EQUAL_TO, x, x, 0));
+  addListLast(nodeA->block, createExpression(0, IF_STATEMENT, a, (int)&nodeC, 0));
+  addListLast(nodeB->block, createExpression(x, ADDITION, x, x, 0));
+  addListLast(nodeC->block, createExpression(x, MULTIPLICATION, x, x, 0));
+  addListLast(nodeD->block, createExpression(x, ADDITION, x, x, 0));
+
+  addChild(&nodeA, &nodeB);
+  addChild(&nodeA, &nodeC);
+  addChild(&nodeB, &nodeD);
+  addChild(&nodeC, &nodeD);
+
+  startVisit(VISIT_SSA);
+  startVisit(VISIT_PHI);
+  startVisit(VISIT_LIVE);
+  markVisited(nodeB, VISIT_SSA);
+  markVisited(nodeB, VISIT_PHI);
+  markVisited(nodeB, VISIT_LIVE);
+
+  FrozenCFG* cfg = freezeCFG(&nodeA);
+  frozenSetLastBrhDom(cfg);
+  frozenAssignAllNodeSSA(cfg, createVersionMap(0), NULL);
+  frozenAllocPhiFunc(cfg);
+
+  TEST_ASSERT_EQUAL(2, nodeD->block->length);
+  TEST_ASSERT_TRUE(isVisited(nodeB, VISIT_SSA));
+  TEST_ASSERT_TRUE(isVisited(nodeB, VISIT_PHI));
+  TEST_ASSERT_TRUE(isVisited(nodeB, VISIT_LIVE));
+  TEST_ASSERT_FALSE(isVisited(nodeA, VISIT_SSA));
+  TEST_ASSERT_FALSE(isVisited(nodeD, VISIT_PHI));
+  TEST_ASSERT_FALSE(isVisited(nodeD, VISIT_LIVE));
+  destroyFrozenCFG(cfg);
+}
+
+#define NUM_OF_RANDOM_NODE  60
+
+/*
+ *  Same random CFG every time it is called with the same seed, the rank
+ *  follow the order the nodes are made in, about a third of the nodes are
+ *  joins and some edges go back up to a node below the root
+ */
+static void createRandomCFG(Node** node, unsigned int seed){
+  int k, from;
+
+  srand(seed);
+  for(k = 0; k < NUM_OF_RANDOM_NODE; k++)
+    node[k] = createNode(k);
+  for(k = 1; k < NUM_OF_RANDOM_NODE; k++){
+    from = rand() % k;
+    addChild(&node[from], &node[k]);
+    if(k > 1 && rand() % 3 == 0)
+      addChild(&node[(from + 1 + rand() % (k - 1)) % k], &node[k]);
+    if(k > 1 && rand() % 5 == 0)
+      addChild(&node[k], &node[rand() % (k - 1) + 1]);
+  }
+}
+
+/**
+ *  The frozen passes give the same imdDom and domFrontiers, in the same
+ *  order, as the Node passes on the same CFG
+ *
+ ***************************************************************************/
+void test_frozen_passes_given_random_CFG_should_match_the_Node_passes(void){
+  Node* node[NUM_OF_RANDOM_NODE];
+  Node* frozenNode[NUM_OF_RANDOM_NODE];
+  Vector *unionDomFrontiers, *frozenUnion;
+  int seed, k, i;
+
+  for(seed = 1; seed <= 20; seed++){
+    createRandomCFG(node, seed);
+    createRandomCFG(frozenNode, seed);
+
+    setLastBrhDom(&node[0]);
+    setAllImdDom(&node[0]);
+    unionDomFrontiers = getAllDomFrontiers(&node[0]);
+
+    FrozenCFG* cfg = freezeCFG(&frozenNode[0]);
+    frozenSetLastBrhDom(cfg);
+    frozenSetAllImdDom(cfg);
+    frozenUnion = frozenGetAllDomFrontiers(cfg);
+
+    TEST_ASSERT_EQUAL(unionDomFrontiers->length, frozenUnion->length);
+    for(k = 0; k < unionDomFrontiers->length; k++)
+      TEST_ASSERT_EQUAL(((Node*)unionDomFrontiers->item[k])->rank, ((Node*)frozenUnion->item[k])->rank);
+    for(k = 0; k < NUM_OF_RANDOM_NODE; k++){
+      if(node[k]->imdDom == NULL){
+        TEST_ASSERT_NULL(frozenNode[k]->imdDom);
+      }else
+        TEST_ASSERT_EQUAL(node[k]->imdDom->rank, frozenNode[k]->imdDom->rank);
+      if(node[k]->domFrontiers == NULL)
+        continue;
+      TEST_ASSERT_EQUAL(node[k]->domFrontiers->length, frozenNode[k]->domFrontiers->length);
+      for(i = 0; i < node[k]->domFrontiers->length; i++)
+        TEST_ASSERT_EQUAL(((Node*)node[k]->domFrontiers->item[i])->rank, \
+                          ((Node*)frozenNode[k]->domFrontiers->item[i])->rank);
+    }
+
+    destroyVector(unionDomFrontiers);
+    destroyVector(frozenUnion);
+    destroyFrozenCFG(cfg);
+    destroyCFG(node[0]);
+    destroyCFG(frozenNode[0]);
+  }
+}
+
+#define NUM_OF_CHAIN_NODE  100000
+
+/**
+ *   [n0] -> [n1] -> ... -> [n(last - 1)] -> [last]
+ *     |                                       ^
+ *     +---------------------------------------+
+ *
+ *  Every block of the chain has n0 as lastBrhDom, the frozen passes must
+ *  not walk the chain again from every block, and the path down to the
+ *  pred of last is not found by recursion
+ *
+ ***************************************************************************/
+void test_frozen_passes_given_deep_chain_should_stay_linear(void){
+  Node** node = malloc(sizeof(Node*) * NUM_OF_CHAIN_NODE);
+  Node* lastNode;
+  Vector* unionDomFrontiers;
+  int k;
+
+  for(k = 0; k < NUM_OF_CHAIN_NODE; k++)
+    node[k] = createNode(k);
+  for(k = 1; k < NUM_OF_CHAIN_NODE; k++)
+    addChild(&node[k - 1], &node[k]);
+  lastNode = node[NUM_OF_CHAIN_NODE - 1];
+  addChild(&node[0], &lastNode);
+
+  FrozenCFG* cfg = freezeCFG(&node[0]);
+  frozenSetLastBrhDom(cfg);
+  frozenSetAllImdDom(cfg);
+  unionDomFrontiers = frozenGetAllDomFrontiers(cfg);
+  frozenAllocPhiFunc(cfg);
+
+  TEST_ASSERT_EQUAL_PTR(node[0], lastNode->imdDom);
+  TEST_ASSERT_EQUAL_PTR(node[NUM_OF_CHAIN_NODE - 3], node[NUM_OF_CHAIN_NODE - 2]->imdDom);
+  TEST_ASSERT_EQUAL(1, unionDomFrontiers->length);
+  TEST_ASSERT_EQUAL_PTR(lastNode, node[1]->domFrontiers->item[0]);
+
+  destroyVector(unionDomFrontiers);
+  destroyFrozenCFG(cfg);
+  destroyCFG(node[0]);
+  free(node);
+}
@@ -2,6 +2,13 @@
 #include "GetList.h"
 #include "ExpressionBlock.h"
 #include "LinkedList.h"
+#include "Vector.h"
+#include "BitSet.h"
+#include "LcaIndex.h"
+#include "VersionMap.h"
+#include "VersionTree.h"
+#include "Arena.h"
+#include "Allocator.h"
 #include "customAssertion.h"
 #include "NodeChain.h"
 #include "ErrorObject.h"
@@ -61,23 +68,20 @@ void test_getSubsList_should_arrange_the_subscript_list(void){
   addListLast(testNode->block, exp2);
   addListLast(testNode->block, exp3);
   
-  LinkedList* testList = getSubsList(testNode->block);
-  ListElement* testPtr = testList->head;
+  Vector* testList = getSubsList(testNode->block);
   
   TEST_ASSERT_EQUAL(9, testList->length);
-  TEST_ASSERT_EQUAL_PTR(&exp1->oprdA, testPtr->node);
-  TEST_ASSERT_EQUAL_PTR(&exp1->oprdB, testPtr->next->node);
-  TEST_ASSERT_EQUAL_PTR(&exp1->id,    testPtr->next->next->node);
-  
-  testPtr = testPtr->next->next->next;
-  TEST_ASSERT_EQUAL_PTR(&exp2->oprdA, testPtr->node);
-  TEST_ASSERT_EQUAL_PTR(&exp2->oprdB, testPtr->next->node);
-  TEST_ASSERT_EQUAL_PTR(&exp2->id,    testPtr->next->next->node);
-  
-  testPtr = testPtr->next->next->next;
-  TEST_ASSERT_EQUAL_PTR(&exp3->oprdA, testPtr->node);
-  TEST_ASSERT_EQUAL_PTR(&exp3->oprdB, testPtr->next->node);
-  TEST_ASSERT_EQUAL_PTR(&exp3->id,    testPtr->next->next->node);
+  TEST_ASSERT_EQUAL_PTR(&exp1->oprdA, testList->item[0]);
+  TEST_ASSERT_EQUAL_PTR(&exp1->oprdB, testList->item[1]);
+  TEST_ASSERT_EQUAL_PTR(&exp1->id,    testList->item[2]);
+  
+  TEST_ASSERT_EQUAL_PTR(&exp2->oprdA, testList->item[3]);
+  TEST_ASSERT_EQUAL_PTR(&exp2->oprdB, testList->item[4]);
+  TEST_ASSERT_EQUAL_PTR(&exp2->id,    testList->item[5]);
+  
+  TEST_ASSERT_EQUAL_PTR(&exp3->oprdA, testList->item[6]);
+  TEST_ASSERT_EQUAL_PTR(&exp3->oprdB, testList->item[7]);
+  TEST_ASSERT_EQUAL_PTR(&exp3->id,    testList->item[8]);
 }
 /**
  *  getSubsList
@@ -89,7 +93,7 @@ void test_getSubsList_should_arrange_the_subscript_list(void){
 void test_getSubsList_should_Throw_ERR_NULL_LIST(void){
   ErrorObject* err;
   Try{
-    LinkedList* testList = getSubsList(NULL);
+    Vector* testList = getSubsList(NULL);
     TEST_FAIL_MESSAGE("Expected ERR_NULL_LIST to be thrown, but nothing happen");
   } Catch(err){
     TEST_ASSERT_EQUAL(ERR_NULL_LIST, err->errorCode);
@@ -239,12 +243,12 @@ void test_updateList_to_check_if_empty_LinkedList_can_be_entered(void){
   Node* testNode = createNode(1);
   addListLast(testNode->block, exp1);
   
-  LinkedList* testList = createLinkedList();
+  VersionMap* testList = createVersionMap(0);
   arrangeSSA(testNode);
   updateList(testNode, testList);
   
   TEST_ASSERT_EQUAL(1, testList->length);
-  TEST_ASSERT_SUBSCRIPT(x, 1, testList->head->node);
+  TEST_ASSERT_SUBSCRIPT(x, 1, &testList->item[0]);
 }
 
 
@@ -283,14 +287,17 @@ void test_updateList_should_return_prevList_and_add_on_x2_y2_when_the_expression
   addListLast(prevNode->block, prev2);
   addListLast(prevNode->block, prev3);
   
-  LinkedList* prevList = getSubsList(prevNode->block);
+  VersionMap* prevList = createVersionMap(0);
+  versionMapPut(prevList, prev1->id, NULL);
+  versionMapPut(prevList, prev2->id, NULL);
+  versionMapPut(prevList, prev3->id, NULL);
   updateList(testNode, prevList);
 
   TEST_ASSERT_EQUAL(4, prevList->length);
-  TEST_ASSERT_SUBSCRIPT(w, 0, prevList->head->node);
-  TEST_ASSERT_SUBSCRIPT(z, 0, prevList->head->next->node);
-  TEST_ASSERT_SUBSCRIPT(x, 2, prevList->head->next->next->node);
-  TEST_ASSERT_SUBSCRIPT(y, 2, prevList->head->next->next->next->node);
+  TEST_ASSERT_SUBSCRIPT(w, 0, &prevList->item[0]);
+  TEST_ASSERT_SUBSCRIPT(z, 0, &prevList->item[1]);
+  TEST_ASSERT_SUBSCRIPT(x, 2, &prevList->item[2]);
+  TEST_ASSERT_SUBSCRIPT(y, 2, &prevList->item[3]);
 }
 
 /**
@@ -303,7 +310,7 @@ void test_updateList_should_return_prevList_and_add_on_x2_y2_when_the_expression
 void test_updateList_should_Throw_ERR_NULL_NODE(void){
   ErrorObject* err;
   Try{
-    updateList(NULL, createLinkedList());
+    updateList(NULL, createVersionMap(0));
     TEST_FAIL_MESSAGE("Expected ERR_NULL_NODE to be thrown, but nothing happen");
   } Catch(err){
     TEST_ASSERT_EQUAL(ERR_NULL_NODE, err->errorCode);
@@ -325,7 +332,7 @@ void test_updateList_should_Throw_ERR_NULL_LIST(void){
     TEST_FAIL_MESSAGE("Expected ERR_NULL_LIST to be thrown, but nothing happen");
   } Catch(err){
     TEST_ASSERT_EQUAL(ERR_NULL_LIST, err->errorCode);
-    TEST_ASSERT_EQUAL_STRING("Input LinkedList to function updateList is NULL", err->errorMsg);
+    TEST_ASSERT_EQUAL_STRING("Input VersionMap to function updateList is NULL", err->errorMsg);
   }
 }
 
@@ -401,9 +408,9 @@ void test_getLatestList_given_NodeA_above_should_return_x2(void){
 
   arrangeSSA(nodeA);
   
-  LinkedList* testList = getLatestList(nodeA, createLinkedList());
+  VersionMap* testList = getLatestList(nodeA, createVersionMap(0));
   TEST_ASSERT_EQUAL(1, testList->length);
-  TEST_ASSERT_SUBSCRIPT(x, 2, testList->head->node);  
+  TEST_ASSERT_SUBSCRIPT(x, 2, &testList->item[0]);  
 }
 
 /**
@@ -437,11 +444,11 @@ void test_getLatestList_given_NodeB_above_should_return_x2_and_z0(void){
   arrangeSSA(nodeA);
   arrangeSSA(nodeB);
   
-  LinkedList* prevList = getLatestList(nodeA, createLinkedList());
-  LinkedList* testList = getLatestList(nodeB, prevList);
+  VersionMap* prevList = getLatestList(nodeA, createVersionMap(0));
+  VersionMap* testList = getLatestList(nodeB, prevList);
   TEST_ASSERT_EQUAL(2, testList->length);
-  TEST_ASSERT_SUBSCRIPT(w, 0, testList->head->node);  
-  TEST_ASSERT_SUBSCRIPT(x, 2, testList->head->next->node);  
+  TEST_ASSERT_SUBSCRIPT(w, 0, &testList->item[0]);  
+  TEST_ASSERT_SUBSCRIPT(x, 2, &testList->item[1]);  
 }
 
 /**
@@ -454,7 +461,7 @@ void test_getLatestList_given_NodeB_above_should_return_x2_and_z0(void){
 void test_getLatestList_should_Throw_ERR_NULL_NODE(void){
   ErrorObject* err;
   Try{
-    LinkedList* testList = getLatestList(NULL, createLinkedList());
+    VersionMap* testList = getLatestList(NULL, createVersionMap(0));
     TEST_FAIL_MESSAGE("Expected ERR_NULL_NODE to be thrown, but nothing happen");
   } Catch(err){
     TEST_ASSERT_EQUAL(ERR_NULL_NODE, err->errorCode);
@@ -571,12 +578,12 @@ void test_getListTillNode_given_NodeB_above_should_return_x2_and_y0(void){
   addListLast(nodeA->block, exp2);
   addListLast(nodeA->block, exp3);
   setLastBrhDom(&nodeA);
-  assignAllNodeSSA(nodeA, createLinkedList(), createLinkedList());
+  assignAllNodeSSA(nodeA, createVersionMap(0), NULL);
   
-  LinkedList* testList = getListTillNode(nodeB);
+  VersionMap* testList = getListTillNode(nodeB);
   TEST_ASSERT_EQUAL(2, testList->length);
-  TEST_ASSERT_SUBSCRIPT(x, 0, testList->head->node);  
-  TEST_ASSERT_SUBSCRIPT(y, 1, testList->head->next->node);  
+  TEST_ASSERT_SUBSCRIPT(x, 0, &testList->item[0]);  
+  TEST_ASSERT_SUBSCRIPT(y, 1, &testList->item[1]);  
 }
 
 /**
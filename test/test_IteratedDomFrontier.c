@@ -0,0 +1,192 @@
+#include "unity.h"
+#include "IteratedDomFrontier.h"
+#include "DomTree.h"
+#include "Dominator.h"
+#include "NodeChain.h"
+#include "ExpressionBlock.h"
+#include "GetList.h"
+#include "customAssertion.h"
+#include "LinkedList.h"
+#include "Vector.h"
+#include "BitSet.h"
+#include "LcaIndex.h"
+#include "VersionMap.h"
+#include "VersionTree.h"
+#include "Arena.h"
+#include "Allocator.h"
+#include "ErrorObject.h"
+#include "CException.h"
+#include <stdlib.h>
+
+int x = 120;
+int y = 121;
+
+void setUp(void){}
+
+void tearDown(void){}
+
+/**
+ *  getIteratedDomFrontiers
+ *
+ *       [A] <<<<<              DF(B) = { D }
+ *      /   \    /\             DF(D) = { A }
+ *    [B]   [C]  /\
+ *      \   /    /\             DF+({ B }) = { A, D }
+ *       [D] >>>>>>
+ *
+ ***************************************************************************/
+void test_getIteratedDomFrontiers_given_loop_should_follow_the_domFrontiers_of_domFrontiers(void){
+  Node* nodeA = createNode(0);
+  Node* nodeB = createNode(1);
+  Node* nodeC = createNode(1);
+  Node* nodeD = createNode(2);
+
+  addChild(&nodeA, &nodeB);
+  addChild(&nodeA, &nodeC);
+  addChild(&nodeB, &nodeD);
+  addChild(&nodeC, &nodeD);
+  addChild(&nodeD, &nodeA);
+  setAllImdDomSemiNCA(&nodeA);
+
+  DomTree* tree     = createDomTree(&nodeA);
+  Vector* defNode   = createVector(0);
+  vectorAddLast(defNode, nodeB);
+  Vector* phiNode   = getIteratedDomFrontiers(tree, defNode);
+
+  Vector* expectPhiNode = createVector(0);
+  vectorAddLast(expectPhiNode, nodeA);
+  vectorAddLast(expectPhiNode, nodeD);
+  TEST_ASSERT_VECTOR(expectPhiNode, phiNode);
+
+  destroyVector(defNode);
+  destroyVector(phiNode);
+  destroyVector(expectPhiNode);
+  destroyDomTree(tree);
+  destroyCFG(nodeA);
+}
+
+/**
+ *  getIteratedDomFrontiers
+ *  On the CFG4 of test_NodeChain the DF+ of every single node should be
+ *  the closure of the domFrontiers given by getAllDomFrontiers
+ *
+ ***************************************************************************/
+void test_getIteratedDomFrontiers_should_match_the_closure_of_getAllDomFrontiers(void){
+  Node* nodeA = createNode(0);
+  Node* nodeB = createNode(1);
+  Node* nodeE = createNode(1);
+  Node* nodeC = createNode(2);
+  Node* nodeF = createNode(2);
+  Node* nodeG = createNode(2);
+  Node* nodeD = createNode(3);
+  Node* nodeH = createNode(3);
+  Node* nodeI = createNode(4);
+  Node* node[] = {nodeA, nodeB, nodeE, nodeC, nodeF, nodeG, nodeD, nodeH, nodeI};
+  Vector *defNode, *phiNode, *closure;
+  BitSet* closureSet = createBitSet(0);
+  Node* nodePtr;
+  int i, k, m;
+
+  addChild(&nodeA, &nodeB);
+  addChild(&nodeA, &nodeE);
+  addChild(&nodeB, &nodeC);
+  addChild(&nodeE, &nodeF);
+  addChild(&nodeE, &nodeG);
+  addChild(&nodeC, &nodeC);
+  addChild(&nodeC, &nodeD);
+  addChild(&nodeF, &nodeD);
+  addChild(&nodeF, &nodeH);
+  addChild(&nodeG, &nodeH);
+  addChild(&nodeD, &nodeI);
+  addChild(&nodeH, &nodeI);
+  addChild(&nodeH, &nodeE);
+
+  setLastBrhDom(&nodeA);
+  setAllImdDom(&nodeA);
+  destroyVector(getAllDomFrontiers(&nodeA));
+  DomTree* tree = createDomTree(&nodeA);
+
+  for(i = 0; i < 9; i++){
+    closure = createVector(0);
+    bitSetClear(closureSet);
+    vectorAddLast(closure, node[i]);
+    for(k = 0; k < closure->length; k++){
+      nodePtr = closure->item[k];
+      for(m = 0; m < nodePtr->domFrontiers->length; m++){
+        if(!bitSetHas(closureSet, ((Node*)nodePtr->domFrontiers->item[m])->id)){
+          bitSetAdd(closureSet, ((Node*)nodePtr->domFrontiers->item[m])->id);
+          vectorAddLast(closure, nodePtr->domFrontiers->item[m]);
+        }
+      }
+    }
+
+    defNode = createVector(0);
+    vectorAddLast(defNode, node[i]);
+    phiNode = getIteratedDomFrontiers(tree, defNode);
+
+    TEST_ASSERT_EQUAL(bitSetCount(closureSet), phiNode->length);
+    for(k = 0; k < phiNode->length; k++)
+      TEST_ASSERT_TRUE(bitSetHas(closureSet, ((Node*)phiNode->item[k])->id));
+
+    destroyVector(closure);
+    destroyVector(defNode);
+    destroyVector(phiNode);
+  }
+
+  destroyBitSet(closureSet);
+  destroyDomTree(tree);
+  destroyCFG(nodeA);
+}
+
+/**
+ *  getPhiNodes
+ *
+ *       [A](x0, y0)
+ *      /   \
+ *     \/   \/
+ *(x1)[B]   [C](x2)
+ *     |     |
+ *     \/   \/
+ *       [D]        x need a phiFunction in D, y does not
+ *
+ ***************************************************************************/
+void test_getPhiNodes_should_give_the_node_needing_a_phiFunction_of_the_variable(void){
+  Node* nodeA = createNode(0);
+  Node* nodeB = createNode(1);
+  Node* nodeC = createNode(1);
+  Node* nodeD = createNode(2);
+  addListLast(nodeA->block, createExpression(x, ASSIGN, 14, 0, 0));
+  addListLast(nodeA->block, createExpression(y, ASSIGN, 3, 0, 0));
+  addListLast(nodeB->block, createExpression(x, ADDITION, x, x, 0));
+  addListLast(nodeC->block, createExpression(x, MULTIPLICATION, y, y, 0));
+
+  addChild(&nodeA, &nodeB);
+  addChild(&nodeA, &nodeC);
+  addChild(&nodeB, &nodeD);
+  addChild(&nodeC, &nodeD);
+  setAllImdDomIterative(&nodeA);
+  DomTree* tree = createDomTree(&nodeA);
+
+  Vector* phiNodeX = getPhiNodes(tree, x);
+  Vector* phiNodeY = getPhiNodes(tree, y);
+
+  TEST_ASSERT_EQUAL(1, phiNodeX->length);
+  TEST_ASSERT_EQUAL_PTR(nodeD, phiNodeX->item[0]);
+  TEST_ASSERT_EQUAL(0, phiNodeY->length);
+
+  destroyVector(phiNodeX);
+  destroyVector(phiNodeY);
+  destroyDomTree(tree);
+  destroyCFG(nodeA);
+}
+
+void test_getIteratedDomFrontiers_given_NULL_should_throw_ERR_NULL_LIST(void){
+  ErrorObject* err;
+  Try{
+    getIteratedDomFrontiers(NULL, NULL);
+    TEST_FAIL_MESSAGE("Expected ERR_NULL_LIST but none thrown");
+  }Catch(err){
+    TEST_ASSERT_EQUAL(ERR_NULL_LIST, err->errorCode);
+    freeError(err);
+  }
+}
@@ -0,0 +1,88 @@
+#include "unity.h"
+#include "LcaIndex.h"
+#include "Arena.h"
+#include "Allocator.h"
+#include "ErrorObject.h"
+#include "CException.h"
+#include <stdlib.h>
+
+void setUp(void){}
+
+void tearDown(void){}
+
+/**
+ *  lcaIndexFind
+ *
+ *        0
+ *        |
+ *        1
+ *       / \
+ *      2   3
+ *      |
+ *      4       5
+ *
+ ***************************************************************************/
+void test_lcaIndexFind_should_give_the_lowest_common_ancestor(void){
+  LcaIndex* index = createLcaIndex(6);
+
+  lcaIndexPut(index, 0, LCA_NO_PARENT);
+  lcaIndexPut(index, 1, 0);
+  lcaIndexPut(index, 2, 1);
+  lcaIndexPut(index, 3, 1);
+  lcaIndexPut(index, 4, 2);
+  lcaIndexPut(index, 5, LCA_NO_PARENT);
+
+  TEST_ASSERT_EQUAL(1, lcaIndexFind(index, 4, 3));
+  TEST_ASSERT_EQUAL(1, lcaIndexFind(index, 3, 4));
+  TEST_ASSERT_EQUAL(2, lcaIndexFind(index, 4, 2));
+  TEST_ASSERT_EQUAL(0, lcaIndexFind(index, 0, 4));
+  TEST_ASSERT_EQUAL(3, lcaIndexFind(index, 3, 3));
+  TEST_ASSERT_EQUAL(LCA_NO_PARENT, lcaIndexFind(index, 4, 5));
+  TEST_ASSERT_EQUAL(3, index->depth[4]);
+  destroyLcaIndex(index);
+}
+
+/**
+ *  lcaIndexFind
+ *  A path of 5000 slot, the meet of the bottom and any slot is that slot
+ *
+ ***************************************************************************/
+void test_lcaIndexFind_given_long_path_should_jump_to_the_ancestor(void){
+  int s, numOfSlot = 5000;
+  LcaIndex* index = createLcaIndex(numOfSlot + 1);
+
+  lcaIndexPut(index, 0, LCA_NO_PARENT);
+  for(s = 1; s < numOfSlot; s++)
+    lcaIndexPut(index, s, s - 1);
+  lcaIndexPut(index, numOfSlot, 1234);
+
+  for(s = 0; s < numOfSlot; s += 97)
+    TEST_ASSERT_EQUAL(s, lcaIndexFind(index, numOfSlot - 1, s));
+  TEST_ASSERT_EQUAL(1234, lcaIndexFind(index, numOfSlot, numOfSlot - 1));
+  destroyLcaIndex(index);
+}
+
+void test_lcaIndexFind_given_slot_not_put_should_give_LCA_NO_PARENT(void){
+  LcaIndex* index = createLcaIndex(4);
+
+  lcaIndexPut(index, 0, LCA_NO_PARENT);
+
+  TEST_ASSERT_FALSE(lcaIndexHas(index, 1));
+  TEST_ASSERT_EQUAL(LCA_NO_PARENT, lcaIndexFind(index, 0, 1));
+  TEST_ASSERT_EQUAL(LCA_NO_PARENT, lcaIndexFind(index, 0, -1));
+  destroyLcaIndex(index);
+}
+
+void test_lcaIndexPut_before_the_parent_should_throw_ERR_INDEX_OUT_OF_RANGE(void){
+  LcaIndex* index = createLcaIndex(4);
+  ErrorObject* err;
+
+  Try{
+    lcaIndexPut(index, 2, 1);
+    TEST_FAIL_MESSAGE("Expected ERR_INDEX_OUT_OF_RANGE but none thrown");
+  }Catch(err){
+    TEST_ASSERT_EQUAL(ERR_INDEX_OUT_OF_RANGE, err->errorCode);
+    freeError(err);
+  }
+  destroyLcaIndex(index);
+}
@@ -0,0 +1,148 @@
+#include "unity.h"
+#include "LinkedList.h"
+#include "Arena.h"
+#include "Allocator.h"
+#include "ErrorObject.h"
+#include "CException.h"
+#include <stdlib.h>
+
+int itemA = 1, itemB = 2, itemC = 3;
+
+void setUp(void){}
+
+void tearDown(void){}
+
+/**
+ *  addListLast / addListFirst
+ *  Both direction of the list should be linked
+ *
+ *   head                tail
+ *      \-[C]<->[A]<->[B]-/
+ *
+ ***************************************************************************/
+void test_addListLast_and_addListFirst_should_link_both_direction(void){
+  LinkedList* testList = createLinkedList();
+
+  addListLast(testList, &itemA);
+  addListLast(testList, &itemB);
+  addListFirst(testList, &itemC);
+
+  TEST_ASSERT_EQUAL(3, testList->length);
+  TEST_ASSERT_EQUAL_PTR(&itemC, testList->head->node);
+  TEST_ASSERT_EQUAL_PTR(&itemA, testList->head->next->node);
+  TEST_ASSERT_EQUAL_PTR(&itemB, testList->tail->node);
+  TEST_ASSERT_NULL(testList->head->prev);
+  TEST_ASSERT_NULL(testList->tail->next);
+  TEST_ASSERT_EQUAL_PTR(&itemA, testList->tail->prev->node);
+  TEST_ASSERT_EQUAL_PTR(testList->head, testList->head->next->prev);
+}
+
+/**
+ *  listRemoveFirst / listRemoveLast
+ *
+ *   [A]<->[B]<->[C]   removeLast => C   removeFirst => A    [B]
+ *
+ ***************************************************************************/
+void test_listRemoveFirst_and_listRemoveLast(void){
+  LinkedList* testList = createLinkedList();
+  addListLast(testList, &itemA);
+  addListLast(testList, &itemB);
+  addListLast(testList, &itemC);
+
+  ListElement* removed = listRemoveLast(testList);
+  TEST_ASSERT_EQUAL_PTR(&itemC, removed->node);
+  TEST_ASSERT_NULL(removed->prev);
+
+  removed = listRemoveFirst(testList);
+  TEST_ASSERT_EQUAL_PTR(&itemA, removed->node);
+  TEST_ASSERT_NULL(removed->next);
+
+  TEST_ASSERT_EQUAL(1, testList->length);
+  TEST_ASSERT_EQUAL_PTR(testList->head, testList->tail);
+  TEST_ASSERT_NULL(testList->head->prev);
+  TEST_ASSERT_NULL(testList->tail->next);
+
+  listRemoveLast(testList);
+  TEST_ASSERT_EQUAL(0, testList->length);
+  TEST_ASSERT_NULL(testList->head);
+  TEST_ASSERT_NULL(testList->tail);
+}
+
+/**
+ *  listRemoveElement
+ *  Removing the middle element should relink its neighbours
+ *
+ *   [A]<->[B]<->[C]   =>   [A]<->[C]
+ *
+ ***************************************************************************/
+void test_listRemoveElement_given_middle_element_should_relink_neighbours(void){
+  LinkedList* testList = createLinkedList();
+  addListLast(testList, &itemA);
+  addListLast(testList, &itemB);
+  addListLast(testList, &itemC);
+
+  ListElement* middle = testList->head->next;
+  listRemoveElement(testList, middle);
+
+  TEST_ASSERT_EQUAL(2, testList->length);
+  TEST_ASSERT_EQUAL_PTR(&itemC, testList->head->next->node);
+  TEST_ASSERT_EQUAL_PTR(&itemA, testList->tail->prev->node);
+  TEST_ASSERT_NULL(middle->next);
+  TEST_ASSERT_NULL(middle->prev);
+}
+
+void test_listRemoveFirst_should_throw_ERR_EMPTY_LIST(void){
+  ErrorObject* err;
+  Try{
+    listRemoveFirst(createLinkedList());
+    TEST_FAIL_MESSAGE("Expected ERR_EMPTY_LIST but no error thrown");
+  } Catch(err){
+    TEST_ASSERT_EQUAL(ERR_EMPTY_LIST, err->errorCode);
+  }
+}
+
+/**
+ *  listRemoveLast
+ *  Removing should not take any new memory
+ *
+ ***************************************************************************/
+void test_listRemoveLast_should_not_allocate(void){
+  beginCompileSession();
+  LinkedList* testList = createLinkedList();
+  addListLast(testList, &itemA);
+  addListLast(testList, &itemB);
+  listRemoveLast(testList);
+  listRemoveFirst(testList);
+
+  ArenaStats stats = endCompileSession();
+  TEST_ASSERT_EQUAL(3, stats.numOfAlloc);
+}
+
+static int numOfPayloadDestroyed = 0;
+
+static void countPayload(void* payload){
+  numOfPayloadDestroyed += *(int*)payload;
+}
+
+/**
+ *  destroyLinkedListWithPayload
+ *  Every payload should be handed to the callback once and all memory
+ *  of the list should be given back
+ *
+ ***************************************************************************/
+void test_destroyLinkedListWithPayload_should_destroy_every_payload(void){
+  resetMemoryStats();
+  LinkedList* testList = createLinkedList();
+  addListLast(testList, &itemA);
+  addListLast(testList, &itemB);
+  addListLast(testList, &itemC);
+  destroyListElement(listRemoveFirst(testList));
+
+  numOfPayloadDestroyed = 0;
+  destroyLinkedListWithPayload(testList, countPayload);
+
+  MemoryStats listStats = getMemoryStats(MEM_LIST);
+  TEST_ASSERT_EQUAL(5, numOfPayloadDestroyed);
+  TEST_ASSERT_EQUAL(listStats.numOfAlloc, listStats.numOfFree);
+  TEST_ASSERT_EQUAL(listStats.bytesAlloc, listStats.bytesFreed);
+}
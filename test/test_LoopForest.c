@@ -0,0 +1,210 @@
+#include "unity.h"
+#include "LoopForest.h"
+#include "NodeChain.h"
+#include "ExpressionBlock.h"
+#include "GetList.h"
+#include "customAssertion.h"
+#include "LinkedList.h"
+#include "Vector.h"
+#include "BitSet.h"
+#include "LcaIndex.h"
+#include "VersionMap.h"
+#include "VersionTree.h"
+#include "Arena.h"
+#include "Allocator.h"
+#include "ErrorObject.h"
+#include "CException.h"
+#include <stdlib.h>
+
+void setUp(void){}
+
+void tearDown(void){}
+
+/**
+ *  CFG:
+ *
+ *          [A]
+ *           |
+ *  +-----> [B]             loop 0 = { B, C, D }  header B  latch D  exit E
+ *  |      /   \            loop 1 = { C, D }     header C  latch D  exit B
+ *  | +->[C]   [E]
+ *  | |   |
+ *  +-+--[D]
+ *
+ ***************************************************************************/
+void test_createLoopForest_should_give_headers_latches_exits_and_depth(void){
+  Node* nodeA = createNode(0);
+  Node* nodeB = createNode(1);
+  Node* nodeC = createNode(2);
+  Node* nodeD = createNode(3);
+  Node* nodeE = createNode(2);
+
+  addChild(&nodeA, &nodeB);
+  addChild(&nodeB, &nodeC);
+  addChild(&nodeB, &nodeE);
+  addChild(&nodeC, &nodeD);
+  addChild(&nodeD, &nodeC);
+  addChild(&nodeD, &nodeB);
+
+  LoopForest* forest = createLoopForest(&nodeA);
+
+  TEST_ASSERT_EQUAL(5, forest->numOfNode);
+  TEST_ASSERT_EQUAL(2, forest->numOfLoop);
+  TEST_ASSERT_EQUAL_PTR(nodeB, forest->node[forest->header[0]]);
+  TEST_ASSERT_EQUAL_PTR(nodeC, forest->node[forest->header[1]]);
+  TEST_ASSERT_EQUAL(NOT_IN_LOOP, forest->parent[0]);
+  TEST_ASSERT_EQUAL(0, forest->parent[1]);
+  TEST_ASSERT_EQUAL(LOOP_REDUCIBLE, forest->kind[0]);
+  TEST_ASSERT_EQUAL(LOOP_REDUCIBLE, forest->kind[1]);
+
+  TEST_ASSERT_EQUAL(NOT_IN_LOOP, getLoopOf(forest, nodeA));
+  TEST_ASSERT_EQUAL(0, getLoopOf(forest, nodeB));
+  TEST_ASSERT_EQUAL(1, getLoopOf(forest, nodeC));
+  TEST_ASSERT_EQUAL(1, getLoopOf(forest, nodeD));
+  TEST_ASSERT_EQUAL(NOT_IN_LOOP, getLoopOf(forest, nodeE));
+  TEST_ASSERT_TRUE(loopContains(forest, 0, nodeD));
+  TEST_ASSERT_FALSE(loopContains(forest, 1, nodeB));
+  TEST_ASSERT_TRUE(isLoopHeader(forest, nodeC));
+  TEST_ASSERT_FALSE(isLoopHeader(forest, nodeD));
+
+  TEST_ASSERT_EQUAL(0, nodeA->loopDepth);
+  TEST_ASSERT_EQUAL(1, nodeB->loopDepth);
+  TEST_ASSERT_EQUAL(2, nodeC->loopDepth);
+  TEST_ASSERT_EQUAL(2, nodeD->loopDepth);
+  TEST_ASSERT_EQUAL(0, nodeE->loopDepth);
+
+  TEST_ASSERT_EQUAL(1, forest->latchStart[1] - forest->latchStart[0]);
+  TEST_ASSERT_EQUAL_PTR(nodeD, forest->node[forest->latch[forest->latchStart[0]]]);
+  TEST_ASSERT_EQUAL(1, forest->latchStart[2] - forest->latchStart[1]);
+  TEST_ASSERT_EQUAL_PTR(nodeD, forest->node[forest->latch[forest->latchStart[1]]]);
+  TEST_ASSERT_EQUAL(1, forest->exitStart[1] - forest->exitStart[0]);
+  TEST_ASSERT_EQUAL_PTR(nodeE, forest->node[forest->exit[forest->exitStart[0]]]);
+  TEST_ASSERT_EQUAL(1, forest->exitStart[2] - forest->exitStart[1]);
+  TEST_ASSERT_EQUAL_PTR(nodeB, forest->node[forest->exit[forest->exitStart[1]]]);
+
+  destroyLoopForest(forest);
+  destroyCFG(nodeA);
+}
+
+/**
+ *  CFG:
+ *
+ *       [A]              B and C can both be entered from A, so neither
+ *      /   \             dominate the other. The cycle B <-> C is one
+ *    [B]<->[C]           irreducible loop headed by B. C loop on itself
+ *           |            as well but is still only in the one loop.
+ *          [D]
+ *
+ ***************************************************************************/
+void test_createLoopForest_given_irreducible_region_should_give_one_loop(void){
+  Node* nodeA = createNode(0);
+  Node* nodeB = createNode(1);
+  Node* nodeC = createNode(1);
+  Node* nodeD = createNode(2);
+
+  addChild(&nodeA, &nodeB);
+  addChild(&nodeA, &nodeC);
+  addChild(&nodeB, &nodeC);
+  addChild(&nodeC, &nodeB);
+  addChild(&nodeC, &nodeC);
+  addChild(&nodeC, &nodeD);
+
+  LoopForest* forest = createLoopForest(&nodeA);
+
+  TEST_ASSERT_EQUAL(2, forest->numOfLoop);
+  TEST_ASSERT_EQUAL_PTR(nodeB, forest->node[forest->header[0]]);
+  TEST_ASSERT_EQUAL(LOOP_IRREDUCIBLE, forest->kind[0]);
+  TEST_ASSERT_EQUAL_PTR(nodeC, forest->node[forest->header[1]]);
+  TEST_ASSERT_EQUAL(LOOP_SELF, forest->kind[1]);
+  TEST_ASSERT_EQUAL(0, forest->parent[1]);
+  TEST_ASSERT_EQUAL(1, nodeB->loopDepth);
+  TEST_ASSERT_EQUAL(2, nodeC->loopDepth);
+  TEST_ASSERT_EQUAL(0, nodeD->loopDepth);
+  TEST_ASSERT_EQUAL(1, forest->exitStart[1] - forest->exitStart[0]);
+  TEST_ASSERT_EQUAL_PTR(nodeD, forest->node[forest->exit[forest->exitStart[0]]]);
+
+  destroyLoopForest(forest);
+  destroyCFG(nodeA);
+}
+
+void test_createLoopForest_given_no_back_edge_should_give_no_loop(void){
+  Node* nodeA = createNode(0);
+  Node* nodeB = createNode(1);
+  Node* nodeC = createNode(1);
+  Node* nodeD = createNode(2);
+
+  addChild(&nodeA, &nodeB);
+  addChild(&nodeA, &nodeC);
+  addChild(&nodeB, &nodeD);
+  addChild(&nodeC, &nodeD);
+
+  LoopForest* forest = createLoopForest(&nodeA);
+
+  TEST_ASSERT_EQUAL(4, forest->numOfNode);
+  TEST_ASSERT_EQUAL(0, forest->numOfLoop);
+  TEST_ASSERT_EQUAL(NOT_IN_LOOP, getLoopOf(forest, nodeD));
+  TEST_ASSERT_EQUAL(0, nodeD->loopDepth);
+
+  destroyLoopForest(forest);
+  destroyCFG(nodeA);
+}
+
+/**
+ *  2000 loop nested in each other, the walk does not recurse
+ *
+ *    head0 -> head1 -> ... -> head1999 -> tail1999 -> ... -> tail0 -> exit
+ *      ^        ^                 ^________/                   |
+ *      |        |______________________________________________|   (tail(k) -> head(k))
+ *
+ ***************************************************************************/
+void test_createLoopForest_given_deep_nesting_should_give_the_depth_of_every_node(void){
+  int k, depth = 2000;
+  Node** head = malloc(sizeof(Node*) * depth);
+  Node** tail = malloc(sizeof(Node*) * depth);
+  Node* exitNode;
+
+  for(k = 0; k < depth; k++)
+    head[k] = createNode(k);
+  for(k = depth - 1; k >= 0; k--)
+    tail[k] = createNode(2 * depth - 1 - k);
+  exitNode = createNode(2 * depth);
+
+  for(k = 0; k < depth - 1; k++)
+    addChild(&head[k], &head[k + 1]);
+  addChild(&head[depth - 1], &tail[depth - 1]);
+  for(k = depth - 1; k > 0; k--){
+    addChild(&tail[k], &head[k]);
+    addChild(&tail[k], &tail[k - 1]);
+  }
+  addChild(&tail[0], &head[0]);
+  addChild(&tail[0], &exitNode);
+
+  LoopForest* forest = createLoopForest(&head[0]);
+
+  TEST_ASSERT_EQUAL(depth, forest->numOfLoop);
+  for(k = 0; k < depth; k++){
+    TEST_ASSERT_EQUAL(k + 1, head[k]->loopDepth);
+    TEST_ASSERT_EQUAL(k + 1, tail[k]->loopDepth);
+    TEST_ASSERT_EQUAL(k, getLoopOf(forest, tail[k]));
+    TEST_ASSERT_EQUAL(k - 1, forest->parent[k]);
+  }
+  TEST_ASSERT_EQUAL(0, exitNode->loopDepth);
+  TEST_ASSERT_EQUAL_PTR(exitNode, forest->node[forest->exit[forest->exitStart[0]]]);
+
+  destroyLoopForest(forest);
+  destroyCFG(head[0]);
+  free(head);
+  free(tail);
+}
+
+void test_createLoopForest_given_NULL_should_throw_ERR_NULL_NODE(void){
+  Node* nodeA = NULL;
+  ErrorObject* err;
+  Try{
+    createLoopForest(&nodeA);
+    TEST_FAIL_MESSAGE("Expected ERR_NULL_NODE but none thrown");
+  }Catch(err){
+    TEST_ASSERT_EQUAL(ERR_NULL_NODE, err->errorCode);
+    freeError(err);
+  }
+}
@@ -4,6 +4,13 @@
 #include "ErrorObject.h"
 #include "customAssertion.h"
 #include "LinkedList.h"
+#include "Vector.h"
+#include "BitSet.h"
+#include "LcaIndex.h"
+#include "VersionMap.h"
+#include "VersionTree.h"
+#include "Arena.h"
+#include "Allocator.h"
 #include "GetList.h"
 #include "CException.h"
 #include <stdlib.h>
@@ -19,14 +26,16 @@ void test_createNode(void){
 
   TEST_ASSERT_NOT_NULL(testNode);
   TEST_ASSERT_EQUAL(0, testNode->rank);
-  TEST_ASSERT_EQUAL(0, testNode->visitFlag);
+  TEST_ASSERT_FALSE(isVisited(testNode, VISIT_SSA));
+  TEST_ASSERT_FALSE(isVisited(testNode, VISIT_PHI));
+  TEST_ASSERT_FALSE(isVisited(testNode, VISIT_LIVE));
   TEST_ASSERT_EQUAL(0, testNode->numOfChild);
   TEST_ASSERT_EQUAL(0, testNode->block->length);
-  TEST_ASSERT_EQUAL(0, testNode->directDom->length);
+  TEST_ASSERT_EQUAL(0, testNode->numOfDirectDom);
   TEST_ASSERT_NULL(testNode->parent);
   TEST_ASSERT_NULL(testNode->lastBrhDom);
   TEST_ASSERT_NULL(testNode->imdDom);
-  TEST_ASSERT_NULL(testNode->children);
+  TEST_ASSERT_EQUAL_PTR(testNode->inlineChild, testNode->children);
   TEST_ASSERT_NULL(testNode->domFrontiers);
 }
 
@@ -107,6 +116,115 @@ void test_addChild_given_parentNode_add_3_childNode_should_link_it_as_tree_above
   TEST_ASSERT_NODE_ADDRESS(childNodeC, childNodeD->parent);
 }
 
+/**
+ *  addChild
+ *  Every edge should also put the parent into the directDom of the child,
+ *  in the order the edges were added
+ *
+ *           [parent]
+ *            /   \
+ *          [B]   [C]
+ *            \   /
+ *             [D]
+ ***************************************/
+void test_addChild_should_keep_directDom_of_the_child(void){
+  Node* parentNode  = createNode(0);
+  Node* childNodeB  = createNode(1);
+  Node* childNodeC  = createNode(1);
+  Node* childNodeD  = createNode(2);
+
+  addChild(&parentNode, &childNodeB);
+  addChild(&parentNode, &childNodeC);
+  addChild(&childNodeC, &childNodeD);
+  addChild(&childNodeB, &childNodeD);
+
+  TEST_ASSERT_EQUAL(0, parentNode->numOfDirectDom);
+  TEST_ASSERT_EQUAL(1, childNodeB->numOfDirectDom);
+  TEST_ASSERT_NODE_ADDRESS(parentNode, childNodeB->directDom[0]);
+  TEST_ASSERT_EQUAL(2, childNodeD->numOfDirectDom);
+  TEST_ASSERT_NODE_ADDRESS(childNodeC, childNodeD->directDom[0]);
+  TEST_ASSERT_NODE_ADDRESS(childNodeB, childNodeD->directDom[1]);
+}
+
+/**
+ *  removeChild
+ *  Removing B -> D should take the edge out of both side and move the
+ *  parent of D back to C
+ *
+ *       [A]              [A]
+ *       / \              / \
+ *     [B] [C]    =>    [B] [C]
+ *       \ /                 /
+ *       [D]              [D]
+ ***************************************/
+void test_removeChild_should_take_the_edge_out_of_both_node(void){
+  Node* nodeA  = createNode(0);
+  Node* nodeB  = createNode(1);
+  Node* nodeC  = createNode(1);
+  Node* nodeD  = createNode(2);
+
+  addChild(&nodeA, &nodeB);
+  addChild(&nodeA, &nodeC);
+  addChild(&nodeC, &nodeD);
+  addChild(&nodeB, &nodeD);
+  removeChild(&nodeB, &nodeD);
+
+  TEST_ASSERT_EQUAL(0, nodeB->numOfChild);
+  TEST_ASSERT_EQUAL(1, nodeD->numOfDirectDom);
+  TEST_ASSERT_NODE_ADDRESS(nodeC, nodeD->directDom[0]);
+  TEST_ASSERT_NODE_ADDRESS(nodeC, nodeD->parent);
+
+  removeChild(&nodeA, &nodeB);
+  TEST_ASSERT_EQUAL(1, nodeA->numOfChild);
+  TEST_ASSERT_NODE_ADDRESS(nodeC, nodeA->children[0]);
+  TEST_ASSERT_NULL(nodeB->parent);
+}
+
+void test_removeChild_given_no_edge_should_throw_ERR_NO_EDGE(void){
+  Node* nodeA  = createNode(0);
+  Node* nodeB  = createNode(1);
+  ErrorObject* err;
+
+  Try{
+    removeChild(&nodeA, &nodeB);
+    TEST_FAIL_MESSAGE("Expected ERR_NO_EDGE but none thrown");
+  }Catch(err){
+    TEST_ASSERT_EQUAL(ERR_NO_EDGE, err->errorCode);
+    freeError(err);
+  }
+}
+
+/**
+ *  addChild
+ *  The first NODE_INLINE_EDGE children should stay inside the node, the
+ *  third child move all of them to the heap in their original order
+ *
+ *        [parent]
+ *       /   |   \
+ *     [B]  [C]  [D]
+ ***************************************/
+void test_addChild_given_3_childNode_should_spill_children_to_the_heap(void){
+  Node* parentNode  = createNode(0);
+  Node* childNodeB  = createNode(1);
+  Node* childNodeC  = createNode(1);
+  Node* childNodeD  = createNode(1);
+
+  resetMemoryStats();
+  addChild(&parentNode, &childNodeB);
+  addChild(&parentNode, &childNodeC);
+  TEST_ASSERT_EQUAL_PTR(parentNode->inlineChild, parentNode->children);
+  TEST_ASSERT_EQUAL(0, getMemoryStats(MEM_NODE).numOfAlloc);
+
+  addChild(&parentNode, &childNodeD);
+  TEST_ASSERT_TRUE(parentNode->children != parentNode->inlineChild);
+  TEST_ASSERT_EQUAL(1, getMemoryStats(MEM_NODE).numOfAlloc);
+  TEST_ASSERT_EQUAL(3, parentNode->numOfChild);
+  TEST_ASSERT_NODE_ADDRESS(childNodeB, parentNode->children[0]);
+  TEST_ASSERT_NODE_ADDRESS(childNodeC, parentNode->children[1]);
+  TEST_ASSERT_NODE_ADDRESS(childNodeD, parentNode->children[2]);
+  destroyNode(parentNode);
+}
+
 /**
  *  assembleList
  *  This function should be able to add all the node in a Node Tree into
@@ -153,23 +271,23 @@ void test_assembleList_given_node_tree_X_above_should_move_into_ListX(void){
   addChild(&nodeJ, &nodeK);
   addChild(&nodeK, &nodeH);
 
-  LinkedList* testList  = assembleList(&nodeA);
+  Vector* testList  = assembleList(&nodeA);
 
-  LinkedList* expectedList = createLinkedList();
+  Vector* expectedList = createVector(0);
 
-  addListLast(expectedList, nodeA);
-  addListLast(expectedList, nodeB);
-  addListLast(expectedList, nodeC);
-  addListLast(expectedList, nodeD);
-  addListLast(expectedList, nodeE);
-  addListLast(expectedList, nodeF);
-  addListLast(expectedList, nodeG);
-  addListLast(expectedList, nodeH);
-  addListLast(expectedList, nodeI);
-  addListLast(expectedList, nodeJ);
-  addListLast(expectedList, nodeK);
+  vectorAddLast(expectedList, nodeA);
+  vectorAddLast(expectedList, nodeB);
+  vectorAddLast(expectedList, nodeC);
+  vectorAddLast(expectedList, nodeD);
+  vectorAddLast(expectedList, nodeE);
+  vectorAddLast(expectedList, nodeF);
+  vectorAddLast(expectedList, nodeG);
+  vectorAddLast(expectedList, nodeH);
+  vectorAddLast(expectedList, nodeI);
+  vectorAddLast(expectedList, nodeJ);
+  vectorAddLast(expectedList, nodeK);
 
-  TEST_ASSERT_LINKED_LIST(expectedList, testList);
+  TEST_ASSERT_VECTOR(expectedList, testList);
 
   /*
   ListElement* testPtr  = testList->head;
@@ -493,6 +611,77 @@ void test_setLastBrhDom_give_CFG2_should_assign_lastBranchDominator_of_each_node
 }
 
 
+/**
+ *  startVisit / markVisited / isVisited
+ *  A new visit forget the mark of its own kind only, the other kind and
+ *  a node created later are not touched
+ *
+ ***************************************************************************/
+void test_startVisit_should_forget_the_marks_of_its_kind_only(void){
+  Node* nodeA = createNode(0);
+  Node* nodeB = createNode(1);
+
+  startVisit(VISIT_PHI);
+  startVisit(VISIT_LIVE);
+  markVisited(nodeA, VISIT_PHI);
+  markVisited(nodeA, VISIT_LIVE);
+  markVisited(nodeB, VISIT_LIVE);
+  TEST_ASSERT_TRUE(isVisited(nodeA, VISIT_PHI));
+  TEST_ASSERT_FALSE(isVisited(nodeB, VISIT_PHI));
+
+  startVisit(VISIT_LIVE);
+  Node* nodeC = createNode(2);
+
+  TEST_ASSERT_TRUE(isVisited(nodeA, VISIT_PHI));
+  TEST_ASSERT_FALSE(isVisited(nodeA, VISIT_LIVE));
+  TEST_ASSERT_FALSE(isVisited(nodeB, VISIT_LIVE));
+  TEST_ASSERT_FALSE(isVisited(nodeC, VISIT_LIVE));
+  TEST_ASSERT_FALSE(isVisited(nodeC, VISIT_PHI));
+  destroyNode(nodeA);
+  destroyNode(nodeB);
+  destroyNode(nodeC);
+}
+
+/**
+ *  setLastBrhDom on a deep nesting, every side node join at the end
+ *
+ *     [B0] -> [S0] ------------>\
+ *       |                        \
+ *     [B1] -> [S1] ------------> [J]     LBD(Si) = Bi
+ *       :                        /       LBD(J)  = B0
+ *     [Bn] --------------------->
+ *
+ ***************************************************************************/
+void test_setLastBrhDom_given_deep_nesting_should_meet_at_the_first_branch(void){
+  int i, numOfBranch = 2000;
+  Node** branch = malloc(sizeof(Node*) * (numOfBranch + 1));
+  Node** side   = malloc(sizeof(Node*) * numOfBranch);
+  Node* joinNode;
+
+  for(i = 0; i <= numOfBranch; i++)
+    branch[i] = createNode(i);
+  joinNode = createNode(numOfBranch + 1);
+  for(i = 0; i < numOfBranch; i++){
+    side[i] = createNode(i + 1);
+    addChild(&branch[i], &branch[i + 1]);
+    addChild(&branch[i], &side[i]);
+    addChild(&side[i], &joinNode);
+  }
+  addChild(&branch[numOfBranch], &joinNode);
+
+  setLastBrhDom(&branch[0]);
+
+  for(i = 0; i < numOfBranch; i++){
+    TEST_ASSERT_NODE_ADDRESS(branch[i], side[i]->lastBrhDom);
+    TEST_ASSERT_NODE_ADDRESS(branch[i], branch[i + 1]->lastBrhDom);
+  }
+  TEST_ASSERT_NODE_ADDRESS(branch[0], joinNode->lastBrhDom);
+
+  destroyCFG(branch[0]);
+  free(branch);
+  free(side);
+}
+
 //********************TEST for getImdDom ******************************
 
 /**
@@ -730,6 +919,132 @@ void test_setAllImdDom_given_treeA_above_should_return_expected_imdDom_in_table(
   TEST_ASSERT_EQUAL_PTR(nodeA, nodeI->imdDom);
 }
 
+/**
+ *  setAllImdDom
+ *  Only the walk of the root is kept. On a ladder of diamonds the memory
+ *  kept should grow with the number of node, not with its square.
+ *
+ *     [top0]
+ *     /    \
+ *   [l0]  [r0]
+ *     \    /
+ *     [top1]
+ *       ...
+ *
+ ***************************************************************************/
+void test_setAllImdDom_given_diamond_ladder_should_keep_linear_memory(void){
+  int k, numOfDiamond = 300;
+  Node* rootNode = createNode(0);
+  Node *topNode = rootNode, *prevNode = NULL, *leftNode, *rightNode, *nextNode;
+  MemoryStats listStats;
+
+  for(k = 0; k < numOfDiamond; k++){
+    leftNode  = createNode(3 * k + 1);
+    rightNode = createNode(3 * k + 1);
+    nextNode  = createNode(3 * k + 2);
+    addChild(&topNode, &leftNode);
+    addChild(&topNode, &rightNode);
+    addChild(&leftNode, &nextNode);
+    addChild(&rightNode, &nextNode);
+    prevNode  = topNode;
+    topNode   = nextNode;
+  }
+
+  resetMemoryStats();
+  setLastBrhDom(&rootNode);
+  setAllImdDom(&rootNode);
+  listStats = getMemoryStats(MEM_LIST);
+
+  TEST_ASSERT_EQUAL_PTR(prevNode, topNode->imdDom);
+  TEST_ASSERT_TRUE(listStats.bytesAlloc - listStats.bytesFreed < 64 * (3 * numOfDiamond + 1));
+  destroyCFG(rootNode);
+}
+
+/**
+ *  setAllImdDom
+ *  Every imdDom come from the directDom in one pass over the rank order,
+ *  no node start a walk of its own. On the ladder of diamonds the number
+ *  of list allocated must not grow with the number of node.
+ *
+ ***************************************************************************/
+void test_setAllImdDom_given_diamond_ladder_should_not_walk_from_every_node(void){
+  int k, numOfDiamond = 300;
+  Node* rootNode = createNode(0);
+  Node *topNode = rootNode, *leftNode, *rightNode, *nextNode;
+  MemoryStats listStats;
+
+  for(k = 0; k < numOfDiamond; k++){
+    leftNode  = createNode(3 * k + 1);
+    rightNode = createNode(3 * k + 1);
+    nextNode  = createNode(3 * k + 2);
+    addChild(&topNode, &leftNode);
+    addChild(&topNode, &rightNode);
+    addChild(&leftNode, &nextNode);
+    addChild(&rightNode, &nextNode);
+    topNode   = nextNode;
+  }
+  setLastBrhDom(&rootNode);
+
+  resetMemoryStats();
+  setAllImdDom(&rootNode);
+  listStats = getMemoryStats(MEM_LIST);
+
+  TEST_ASSERT_EQUAL_PTR(leftNode->directDom[0], topNode->imdDom);
+  TEST_ASSERT_EQUAL_PTR(leftNode->directDom[0], leftNode->imdDom);
+  TEST_ASSERT_TRUE(listStats.numOfAlloc < 32);
+  destroyCFG(rootNode);
+}
+
+#define NUM_OF_OLD_NODE  100000
+
+/**
+ *  The ids keep growing with every node made, a pass on a small CFG
+ *  must not pay for the nodes made before it
+ *
+ *        [A]
+ *       /   \
+ *     [B]   [C]
+ *       \   /
+ *        [D]
+ *
+ ***************************************************************************/
+void test_passes_given_many_older_nodes_should_size_scratch_by_the_CFG(void){
+  int k;
+  Node* oldNode;
+  for(k = 0; k < NUM_OF_OLD_NODE; k++){
+    oldNode = createNode(0);
+    destroyNode(oldNode);
+  }
+
+  Node* nodeA = createNode(0);
+  Node* nodeB = createNode(1);
+  Node* nodeC = createNode(1);
+  Node* nodeD = createNode(2);
+  MemoryStats listStats;
+  Vector* domFrontiers;
+
+  addChild(&nodeA, &nodeB);
+  addChild(&nodeA, &nodeC);
+  addChild(&nodeB, &nodeD);
+  addChild(&nodeC, &nodeD);
+
+  resetMemoryStats();
+  getNodeOrder(nodeA, ORDER_RPO);
+  setLastBrhDom(&nodeA);
+  setAllImdDom(&nodeA);
+  domFrontiers = getAllDomFrontiers(&nodeA);
+  splitNode(&nodeA);
+  listStats = getMemoryStats(MEM_LIST);
+
+  TEST_ASSERT_EQUAL_PTR(nodeA, nodeD->imdDom);
+  TEST_ASSERT_EQUAL(1, domFrontiers->length);
+  TEST_ASSERT_EQUAL_PTR(nodeD, domFrontiers->item[0]);
+  TEST_ASSERT_TRUE(listStats.bytesAlloc < 8 * 1024);
+
+  destroyVector(domFrontiers);
+  destroyCFG(nodeA);
+}
+
 /**       ControlFlowGraph1           DomFrontiers
  *
  *          | Entry                 DF(A) = { A }
@@ -758,24 +1073,24 @@ void test_getNodeDomFrontiers_given_CFG1_then_find_domFrontiers_of_each_node_sho
   setLastBrhDom(&nodeA);
   setAllImdDom(&nodeA);
 
-  LinkedList* domFrontiersA = createLinkedList();
-  LinkedList* domFrontiersB = createLinkedList();
-  LinkedList* domFrontiersC = createLinkedList();
-  LinkedList* domFrontiersD = createLinkedList();
-  addListLast(domFrontiersA, nodeA);
-  addListLast(domFrontiersB, nodeD);
-  addListLast(domFrontiersC, nodeD);
-  addListLast(domFrontiersD, nodeA);
+  Vector* domFrontiersA = createVector(0);
+  Vector* domFrontiersB = createVector(0);
+  Vector* domFrontiersC = createVector(0);
+  Vector* domFrontiersD = createVector(0);
+  vectorAddLast(domFrontiersA, nodeA);
+  vectorAddLast(domFrontiersB, nodeD);
+  vectorAddLast(domFrontiersC, nodeD);
+  vectorAddLast(domFrontiersD, nodeA);
 
   nodeA->domFrontiers = getNodeDomFrontiers(nodeA);
   nodeB->domFrontiers = getNodeDomFrontiers(nodeB);
   nodeC->domFrontiers = getNodeDomFrontiers(nodeC);
   nodeD->domFrontiers = getNodeDomFrontiers(nodeD);
 
-  TEST_ASSERT_LINKED_LIST(domFrontiersA, nodeA->domFrontiers);
-  TEST_ASSERT_LINKED_LIST(domFrontiersB, nodeB->domFrontiers);
-  TEST_ASSERT_LINKED_LIST(domFrontiersC, nodeC->domFrontiers);
-  TEST_ASSERT_LINKED_LIST(domFrontiersD, nodeD->domFrontiers);
+  TEST_ASSERT_VECTOR(domFrontiersA, nodeA->domFrontiers);
+  TEST_ASSERT_VECTOR(domFrontiersB, nodeB->domFrontiers);
+  TEST_ASSERT_VECTOR(domFrontiersC, nodeC->domFrontiers);
+  TEST_ASSERT_VECTOR(domFrontiersD, nodeD->domFrontiers);
 }
 
 /**    ControlFlowGraph2         DomFrontiers
@@ -813,16 +1128,16 @@ void test_getNodeDomFrontiers_given_CFG2_then_find_domFrontiers_of_each_node_sho
   setAllImdDom(&nodeA);
 
 
-  LinkedList* domFrontiersA = createLinkedList();
-  LinkedList* domFrontiersB = createLinkedList();
-  LinkedList* domFrontiersC = createLinkedList();
-  LinkedList* domFrontiersD = createLinkedList();
-  LinkedList* domFrontiersE = createLinkedList();
-  LinkedList* domFrontiersF = createLinkedList();
-  addListLast(domFrontiersB, nodeE);
-  addListLast(domFrontiersC, nodeE);
-  addListLast(domFrontiersD, nodeF);
-  addListLast(domFrontiersE, nodeF);
+  Vector* domFrontiersA = createVector(0);
+  Vector* domFrontiersB = createVector(0);
+  Vector* domFrontiersC = createVector(0);
+  Vector* domFrontiersD = createVector(0);
+  Vector* domFrontiersE = createVector(0);
+  Vector* domFrontiersF = createVector(0);
+  vectorAddLast(domFrontiersB, nodeE);
+  vectorAddLast(domFrontiersC, nodeE);
+  vectorAddLast(domFrontiersD, nodeF);
+  vectorAddLast(domFrontiersE, nodeF);
 
   nodeA->domFrontiers = getNodeDomFrontiers(nodeA);
   nodeB->domFrontiers = getNodeDomFrontiers(nodeB);
@@ -831,12 +1146,12 @@ void test_getNodeDomFrontiers_given_CFG2_then_find_domFrontiers_of_each_node_sho
   nodeE->domFrontiers = getNodeDomFrontiers(nodeE);
   nodeF->domFrontiers = getNodeDomFrontiers(nodeF);
 
-  TEST_ASSERT_LINKED_LIST(domFrontiersA, nodeA->domFrontiers);
-  TEST_ASSERT_LINKED_LIST(domFrontiersB, nodeB->domFrontiers);
-  TEST_ASSERT_LINKED_LIST(domFrontiersC, nodeC->domFrontiers);
-  TEST_ASSERT_LINKED_LIST(domFrontiersD, nodeD->domFrontiers);
-  TEST_ASSERT_LINKED_LIST(domFrontiersE, nodeE->domFrontiers);
-  TEST_ASSERT_LINKED_LIST(domFrontiersF, nodeF->domFrontiers);
+  TEST_ASSERT_VECTOR(domFrontiersA, nodeA->domFrontiers);
+  TEST_ASSERT_VECTOR(domFrontiersB, nodeB->domFrontiers);
+  TEST_ASSERT_VECTOR(domFrontiersC, nodeC->domFrontiers);
+  TEST_ASSERT_VECTOR(domFrontiersD, nodeD->domFrontiers);
+  TEST_ASSERT_VECTOR(domFrontiersE, nodeE->domFrontiers);
+  TEST_ASSERT_VECTOR(domFrontiersF, nodeF->domFrontiers);
 }
 
 /**       ControlFlowGraph3           DomFrontiers
@@ -878,16 +1193,16 @@ void test_getNodeDomFrontiers_given_CFG3_then_find_domFrontiers_of_each_node_sho
   setAllImdDom(&nodeA);
 
 
-  LinkedList* domFrontiersA = createLinkedList();
-  LinkedList* domFrontiersB = createLinkedList();
-  LinkedList* domFrontiersC = createLinkedList();
-  LinkedList* domFrontiersD = createLinkedList();
-  LinkedList* domFrontiersE = createLinkedList();
-  LinkedList* domFrontiersF = createLinkedList();
-  addListLast(domFrontiersB, nodeF);
-  addListLast(domFrontiersC, nodeE);
-  addListLast(domFrontiersD, nodeE);
-  addListLast(domFrontiersE, nodeF);
+  Vector* domFrontiersA = createVector(0);
+  Vector* domFrontiersB = createVector(0);
+  Vector* domFrontiersC = createVector(0);
+  Vector* domFrontiersD = createVector(0);
+  Vector* domFrontiersE = createVector(0);
+  Vector* domFrontiersF = createVector(0);
+  vectorAddLast(domFrontiersB, nodeF);
+  vectorAddLast(domFrontiersC, nodeE);
+  vectorAddLast(domFrontiersD, nodeE);
+  vectorAddLast(domFrontiersE, nodeF);
 
   nodeA->domFrontiers = getNodeDomFrontiers(nodeA);
   nodeB->domFrontiers = getNodeDomFrontiers(nodeB);
@@ -896,12 +1211,12 @@ void test_getNodeDomFrontiers_given_CFG3_then_find_domFrontiers_of_each_node_sho
   nodeE->domFrontiers = getNodeDomFrontiers(nodeE);
   nodeF->domFrontiers = getNodeDomFrontiers(nodeF);
 
-  TEST_ASSERT_LINKED_LIST(domFrontiersA, nodeA->domFrontiers);
-  TEST_ASSERT_LINKED_LIST(domFrontiersB, nodeB->domFrontiers);
-  TEST_ASSERT_LINKED_LIST(domFrontiersC, nodeC->domFrontiers);
-  TEST_ASSERT_LINKED_LIST(domFrontiersD, nodeD->domFrontiers);
-  TEST_ASSERT_LINKED_LIST(domFrontiersE, nodeE->domFrontiers);
-  TEST_ASSERT_LINKED_LIST(domFrontiersF, nodeF->domFrontiers);
+  TEST_ASSERT_VECTOR(domFrontiersA, nodeA->domFrontiers);
+  TEST_ASSERT_VECTOR(domFrontiersB, nodeB->domFrontiers);
+  TEST_ASSERT_VECTOR(domFrontiersC, nodeC->domFrontiers);
+  TEST_ASSERT_VECTOR(domFrontiersD, nodeD->domFrontiers);
+  TEST_ASSERT_VECTOR(domFrontiersE, nodeE->domFrontiers);
+  TEST_ASSERT_VECTOR(domFrontiersF, nodeF->domFrontiers);
 }
 
 /**       ControlFlowGraph4          DomFrontiers
@@ -952,28 +1267,28 @@ void test_getNodeDomFrontiers_given_CFG4_then_find_domFrontiers_of_each_node_sho
   setLastBrhDom(&nodeA);
   setAllImdDom(&nodeA);
 
-  LinkedList* domFrontiersA = createLinkedList();
-  LinkedList* domFrontiersB = createLinkedList();
-  LinkedList* domFrontiersC = createLinkedList();
-  LinkedList* domFrontiersD = createLinkedList();
-  LinkedList* domFrontiersE = createLinkedList();
-  LinkedList* domFrontiersF = createLinkedList();
-  LinkedList* domFrontiersG = createLinkedList();
-  LinkedList* domFrontiersH = createLinkedList();
-  LinkedList* domFrontiersI = createLinkedList();
-
-  addListLast(domFrontiersB, nodeD);
-  addListLast(domFrontiersC, nodeC);
-  addListLast(domFrontiersC, nodeD);
-  addListLast(domFrontiersD, nodeI);
-  addListLast(domFrontiersE, nodeD);
-  addListLast(domFrontiersE, nodeI);
-  addListLast(domFrontiersE, nodeE);
-  addListLast(domFrontiersF, nodeD);
-  addListLast(domFrontiersF, nodeH);
-  addListLast(domFrontiersG, nodeH);
-  addListLast(domFrontiersH, nodeI);
-  addListLast(domFrontiersH, nodeE);
+  Vector* domFrontiersA = createVector(0);
+  Vector* domFrontiersB = createVector(0);
+  Vector* domFrontiersC = createVector(0);
+  Vector* domFrontiersD = createVector(0);
+  Vector* domFrontiersE = createVector(0);
+  Vector* domFrontiersF = createVector(0);
+  Vector* domFrontiersG = createVector(0);
+  Vector* domFrontiersH = createVector(0);
+  Vector* domFrontiersI = createVector(0);
+
+  vectorAddLast(domFrontiersB, nodeD);
+  vectorAddLast(domFrontiersC, nodeC);
+  vectorAddLast(domFrontiersC, nodeD);
+  vectorAddLast(domFrontiersD, nodeI);
+  vectorAddLast(domFrontiersE, nodeD);
+  vectorAddLast(domFrontiersE, nodeI);
+  vectorAddLast(domFrontiersE, nodeE);
+  vectorAddLast(domFrontiersF, nodeD);
+  vectorAddLast(domFrontiersF, nodeH);
+  vectorAddLast(domFrontiersG, nodeH);
+  vectorAddLast(domFrontiersH, nodeI);
+  vectorAddLast(domFrontiersH, nodeE);
 
   nodeA->domFrontiers = getNodeDomFrontiers(nodeA);
   nodeB->domFrontiers = getNodeDomFrontiers(nodeB);
@@ -985,15 +1300,15 @@ void test_getNodeDomFrontiers_given_CFG4_then_find_domFrontiers_of_each_node_sho
   nodeH->domFrontiers = getNodeDomFrontiers(nodeH);
   nodeI->domFrontiers = getNodeDomFrontiers(nodeI);
 
-  TEST_ASSERT_LINKED_LIST(domFrontiersA, nodeA->domFrontiers);
-  TEST_ASSERT_LINKED_LIST(domFrontiersB, nodeB->domFrontiers);
-  TEST_ASSERT_LINKED_LIST(domFrontiersC, nodeC->domFrontiers);
-  TEST_ASSERT_LINKED_LIST(domFrontiersD, nodeD->domFrontiers);
-  TEST_ASSERT_LINKED_LIST(domFrontiersE, nodeE->domFrontiers);
-  TEST_ASSERT_LINKED_LIST(domFrontiersF, nodeF->domFrontiers);
-  TEST_ASSERT_LINKED_LIST(domFrontiersG, nodeG->domFrontiers);
-  TEST_ASSERT_LINKED_LIST(domFrontiersH, nodeH->domFrontiers);
-  TEST_ASSERT_LINKED_LIST(domFrontiersI, nodeI->domFrontiers);
+  TEST_ASSERT_VECTOR(domFrontiersA, nodeA->domFrontiers);
+  TEST_ASSERT_VECTOR(domFrontiersB, nodeB->domFrontiers);
+  TEST_ASSERT_VECTOR(domFrontiersC, nodeC->domFrontiers);
+  TEST_ASSERT_VECTOR(domFrontiersD, nodeD->domFrontiers);
+  TEST_ASSERT_VECTOR(domFrontiersE, nodeE->domFrontiers);
+  TEST_ASSERT_VECTOR(domFrontiersF, nodeF->domFrontiers);
+  TEST_ASSERT_VECTOR(domFrontiersG, nodeG->domFrontiers);
+  TEST_ASSERT_VECTOR(domFrontiersH, nodeH->domFrontiers);
+  TEST_ASSERT_VECTOR(domFrontiersI, nodeI->domFrontiers);
 }
 
 /**       ControlFlowGraph1         Union of DomFrontiers
@@ -1024,14 +1339,14 @@ void test_getAllDomFrontiers_given_CFG1_should_give_a_union_of_dominatorFrontier
   setLastBrhDom(&nodeA);
   setAllImdDom(&nodeA);
 
-  LinkedList* unionDomFrontiers = createLinkedList();
-  LinkedList* expectUnionDomFrontiers = createLinkedList();
+  Vector* unionDomFrontiers = createVector(0);
+  Vector* expectUnionDomFrontiers = createVector(0);
 
-  addListLast(expectUnionDomFrontiers, nodeA);
-  addListLast(expectUnionDomFrontiers, nodeD);
+  vectorAddLast(expectUnionDomFrontiers, nodeA);
+  vectorAddLast(expectUnionDomFrontiers, nodeD);
   unionDomFrontiers = getAllDomFrontiers(&nodeA);
 
-  TEST_ASSERT_LINKED_LIST(expectUnionDomFrontiers, unionDomFrontiers);
+  TEST_ASSERT_VECTOR(expectUnionDomFrontiers, unionDomFrontiers);
 
 }
 
@@ -1069,14 +1384,14 @@ void test_getAllDomFrontiers_given_CFG2_should_give_a_union_of_dominatorFrontier
   setLastBrhDom(&nodeA);
   setAllImdDom(&nodeA);
 
-  LinkedList* unionDomFrontiers = createLinkedList();
-  LinkedList* expectUnionDomFrontiers = createLinkedList();
+  Vector* unionDomFrontiers = createVector(0);
+  Vector* expectUnionDomFrontiers = createVector(0);
 
-  addListLast(expectUnionDomFrontiers, nodeE);
-  addListLast(expectUnionDomFrontiers, nodeF);
+  vectorAddLast(expectUnionDomFrontiers, nodeE);
+  vectorAddLast(expectUnionDomFrontiers, nodeF);
   unionDomFrontiers = getAllDomFrontiers(&nodeA);
 
-  TEST_ASSERT_LINKED_LIST(expectUnionDomFrontiers, unionDomFrontiers);
+  TEST_ASSERT_VECTOR(expectUnionDomFrontiers, unionDomFrontiers);
 
 }
 
@@ -1119,14 +1434,14 @@ void test_getAllDomFrontiers_given_CFG3_should_give_a_union_of_dominatorFrontier
   setLastBrhDom(&nodeA);
   setAllImdDom(&nodeA);
 
-  LinkedList* unionDomFrontiers = createLinkedList();
-  LinkedList* expectUnionDomFrontiers = createLinkedList();
+  Vector* unionDomFrontiers = createVector(0);
+  Vector* expectUnionDomFrontiers = createVector(0);
 
-  addListLast(expectUnionDomFrontiers, nodeF);
-  addListLast(expectUnionDomFrontiers, nodeE);
+  vectorAddLast(expectUnionDomFrontiers, nodeF);
+  vectorAddLast(expectUnionDomFrontiers, nodeE);
   unionDomFrontiers = getAllDomFrontiers(&nodeA);
 
-  TEST_ASSERT_LINKED_LIST(expectUnionDomFrontiers, unionDomFrontiers);
+  TEST_ASSERT_VECTOR(expectUnionDomFrontiers, unionDomFrontiers);
 }
 
 /**       ControlFlowGraph4          DomFrontiers
@@ -1177,17 +1492,68 @@ void test_getAllDomFrontiers_given_CFG4_should_give_a_union_of_dominatorFrontier
   setLastBrhDom(&nodeA);
   setAllImdDom(&nodeA);
 
-  LinkedList* unionDomFrontiers = createLinkedList();
-  LinkedList* expectUnionDomFrontiers = createLinkedList();
+  Vector* unionDomFrontiers = createVector(0);
+  Vector* expectUnionDomFrontiers = createVector(0);
 
-  addListLast(expectUnionDomFrontiers, nodeD);
-  addListLast(expectUnionDomFrontiers, nodeI);
-  addListLast(expectUnionDomFrontiers, nodeE);
-  addListLast(expectUnionDomFrontiers, nodeC);
-  addListLast(expectUnionDomFrontiers, nodeH);
+  vectorAddLast(expectUnionDomFrontiers, nodeD);
+  vectorAddLast(expectUnionDomFrontiers, nodeI);
+  vectorAddLast(expectUnionDomFrontiers, nodeE);
+  vectorAddLast(expectUnionDomFrontiers, nodeC);
+  vectorAddLast(expectUnionDomFrontiers, nodeH);
   unionDomFrontiers = getAllDomFrontiers(&nodeA);
 
-  TEST_ASSERT_LINKED_LIST(expectUnionDomFrontiers, unionDomFrontiers);
+  TEST_ASSERT_VECTOR(expectUnionDomFrontiers, unionDomFrontiers);
+}
+
+/**
+ *  getAllDomFrontiers
+ *  Each node of the CFG4 above should get the same domFrontiers, in the
+ *  same order, as getNodeDomFrontiers give it
+ *
+ ***************************************************************************/
+void test_getAllDomFrontiers_given_CFG4_should_give_the_same_domFrontiers_as_getNodeDomFrontiers(void){
+  Node* nodeA = createNode(0);
+  Node* nodeB = createNode(1);
+  Node* nodeE = createNode(1);
+  Node* nodeC = createNode(2);
+  Node* nodeF = createNode(2);
+  Node* nodeG = createNode(2);
+  Node* nodeD = createNode(3);
+  Node* nodeH = createNode(3);
+  Node* nodeI = createNode(4);
+  Node* node[] = {nodeA, nodeB, nodeE, nodeC, nodeF, nodeG, nodeD, nodeH, nodeI};
+  Vector* expectDomFrontiers[9];
+  int i;
+
+  addChild(&nodeA, &nodeB);
+  addChild(&nodeA, &nodeE);
+  addChild(&nodeB, &nodeC);
+  addChild(&nodeE, &nodeF);
+  addChild(&nodeE, &nodeG);
+  addChild(&nodeC, &nodeC);
+  addChild(&nodeC, &nodeD);
+  addChild(&nodeF, &nodeD);
+  addChild(&nodeF, &nodeH);
+  addChild(&nodeG, &nodeH);
+  addChild(&nodeD, &nodeI);
+  addChild(&nodeH, &nodeI);
+  addChild(&nodeH, &nodeE);
+
+  setLastBrhDom(&nodeA);
+  setAllImdDom(&nodeA);
+  for(i = 0; i < 9; i++)
+    expectDomFrontiers[i] = getNodeDomFrontiers(node[i]);
+
+  destroyVector(getAllDomFrontiers(&nodeA));
+  for(i = 0; i < 9; i++){
+    TEST_ASSERT_VECTOR(expectDomFrontiers[i], node[i]->domFrontiers);
+    destroyVector(expectDomFrontiers[i]);
+  }
+  TEST_ASSERT_EQUAL(3, nodeE->domFrontiers->length);
+  TEST_ASSERT_EQUAL_PTR(nodeD, nodeE->domFrontiers->item[0]);
+  TEST_ASSERT_EQUAL_PTR(nodeI, nodeE->domFrontiers->item[1]);
+  TEST_ASSERT_EQUAL_PTR(nodeE, nodeE->domFrontiers->item[2]);
+  destroyCFG(nodeA);
 }
 
 /**
@@ -1214,21 +1580,17 @@ void test_setAllDirectDom_given_node_tree_above_should_assign_directDom(void){
    addChild(&nodeC, &nodeD);
 
    setAllDirectDom(&nodeA);
-   ListElement* testPtr;
-   TEST_ASSERT_EQUAL(0, nodeA->directDom->length);
+   TEST_ASSERT_EQUAL(0, nodeA->numOfDirectDom);
 
-   testPtr = nodeB->directDom->head;
-   TEST_ASSERT_EQUAL(1, nodeB->directDom->length);
-   TEST_ASSERT_NODE_ADDRESS(nodeA, testPtr->node);
+   TEST_ASSERT_EQUAL(1, nodeB->numOfDirectDom);
+   TEST_ASSERT_NODE_ADDRESS(nodeA, nodeB->directDom[0]);
 
-   testPtr = nodeC->directDom->head;
-   TEST_ASSERT_EQUAL(1, nodeC->directDom->length);
-   TEST_ASSERT_NODE_ADDRESS(nodeA, testPtr->node);
+   TEST_ASSERT_EQUAL(1, nodeC->numOfDirectDom);
+   TEST_ASSERT_NODE_ADDRESS(nodeA, nodeC->directDom[0]);
 
-   testPtr = nodeD->directDom->head;
-   TEST_ASSERT_EQUAL(2, nodeD->directDom->length);
-   TEST_ASSERT_NODE_ADDRESS(nodeB, testPtr->node);
-   TEST_ASSERT_NODE_ADDRESS(nodeC, testPtr->next->node);
+   TEST_ASSERT_EQUAL(2, nodeD->numOfDirectDom);
+   TEST_ASSERT_NODE_ADDRESS(nodeB, nodeD->directDom[0]);
+   TEST_ASSERT_NODE_ADDRESS(nodeC, nodeD->directDom[1]);
 }
 
 /**
@@ -1267,19 +1629,19 @@ void test_splitNode_given_treeA_should_form_treeExpected(void){
 
   splitNode(&nodeA);
 
-  LinkedList* testList  = assembleList(&nodeA);
+  Vector* testList  = assembleList(&nodeA);
 
-  LinkedList* expectedList = createLinkedList();
+  Vector* expectedList = createVector(0);
 
-  addListLast(expectedList, nodeA);
-  addListLast(expectedList, nodeB);
-  addListLast(expectedList, nodeC);
-  addListLast(expectedList, nodeD);
-  addListLast(expectedList, nodeE);
-  addListLast(expectedList, nodeF);
-  addListLast(expectedList, nodeF->children[0]);
+  vectorAddLast(expectedList, nodeA);
+  vectorAddLast(expectedList, nodeB);
+  vectorAddLast(expectedList, nodeC);
+  vectorAddLast(expectedList, nodeD);
+  vectorAddLast(expectedList, nodeE);
+  vectorAddLast(expectedList, nodeF);
+  vectorAddLast(expectedList, nodeF->children[0]);
 
-  TEST_ASSERT_LINKED_LIST(expectedList, testList);
+  TEST_ASSERT_VECTOR(expectedList, testList);
   TEST_ASSERT_LINKED_LIST(expectedBlock, nodeF->children[0]->block);
   TEST_ASSERT_NULL(nodeF->block);
   TEST_ASSERT_EQUAL_PTR(nodeD, nodeF->parent);
@@ -1291,6 +1653,13 @@ void test_splitNode_given_treeA_should_form_treeExpected(void){
   TEST_ASSERT_EQUAL(0,nodeF->children[0]->numOfChild);
   TEST_ASSERT_EQUAL(3,nodeF->children[0]->rank);
   TEST_ASSERT_EQUAL_PTR(nodeF->children[0], nodeE->children[0]);
+
+  TEST_ASSERT_EQUAL(2, nodeF->numOfDirectDom);
+  TEST_ASSERT_EQUAL_PTR(nodeC, nodeF->directDom[0]);
+  TEST_ASSERT_EQUAL_PTR(nodeD, nodeF->directDom[1]);
+  TEST_ASSERT_EQUAL(2, nodeF->children[0]->numOfDirectDom);
+  TEST_ASSERT_EQUAL_PTR(nodeF, nodeF->children[0]->directDom[0]);
+  TEST_ASSERT_EQUAL_PTR(nodeE, nodeF->children[0]->directDom[1]);
 }
 
 /**
@@ -1335,22 +1704,22 @@ void test_splitNode_given_treeB_should_form_treeExpected(void){
 
   splitNode(&nodeA);
 
-  LinkedList* testList  = assembleList(&nodeA);
+  Vector* testList  = assembleList(&nodeA);
 
-  LinkedList* expectedList = createLinkedList();
+  Vector* expectedList = createVector(0);
 
-  addListLast(expectedList, nodeA);
-  addListLast(expectedList, nodeB);
-  addListLast(expectedList, nodeC);
-  addListLast(expectedList, nodeD);
-  addListLast(expectedList, nodeE);
-  addListLast(expectedList, nodeF);
-  addListLast(expectedList, nodeG);
-  addListLast(expectedList, nodeH);
-  addListLast(expectedList, nodeH->children[0]);
-  addListLast(expectedList, nodeI);
+  vectorAddLast(expectedList, nodeA);
+  vectorAddLast(expectedList, nodeB);
+  vectorAddLast(expectedList, nodeC);
+  vectorAddLast(expectedList, nodeD);
+  vectorAddLast(expectedList, nodeE);
+  vectorAddLast(expectedList, nodeF);
+  vectorAddLast(expectedList, nodeG);
+  vectorAddLast(expectedList, nodeH);
+  vectorAddLast(expectedList, nodeH->children[0]);
+  vectorAddLast(expectedList, nodeI);
 
-  TEST_ASSERT_LINKED_LIST(expectedList, testList);
+  TEST_ASSERT_VECTOR(expectedList, testList);
   TEST_ASSERT_LINKED_LIST(expectedBlock, nodeH->children[0]->block);
   TEST_ASSERT_NULL(nodeH->block);
   TEST_ASSERT_EQUAL_PTR(nodeE, nodeH->parent);
@@ -1404,22 +1773,22 @@ void test_splitNode_given_treeC_should_form_treeExpected(void){
 
   splitNode(&nodeA);
 
-  LinkedList* testList  = assembleList(&nodeA);
+  Vector* testList  = assembleList(&nodeA);
 
-  LinkedList* expectedList = createLinkedList();
+  Vector* expectedList = createVector(0);
 
-  addListLast(expectedList, nodeA);
-  addListLast(expectedList, nodeB);
-  addListLast(expectedList, nodeC);
-  addListLast(expectedList, nodeD);
-  addListLast(expectedList, nodeE);
-  addListLast(expectedList, nodeF);
-  addListLast(expectedList, nodeG);
-  addListLast(expectedList, nodeH);
-  addListLast(expectedList, nodeH->children[0]);
-  addListLast(expectedList, nodeH->children[0]->children[0]);
+  vectorAddLast(expectedList, nodeA);
+  vectorAddLast(expectedList, nodeB);
+  vectorAddLast(expectedList, nodeC);
+  vectorAddLast(expectedList, nodeD);
+  vectorAddLast(expectedList, nodeE);
+  vectorAddLast(expectedList, nodeF);
+  vectorAddLast(expectedList, nodeG);
+  vectorAddLast(expectedList, nodeH);
+  vectorAddLast(expectedList, nodeH->children[0]);
+  vectorAddLast(expectedList, nodeH->children[0]->children[0]);
 
-  TEST_ASSERT_LINKED_LIST(expectedList, testList);
+  TEST_ASSERT_VECTOR(expectedList, testList);
   TEST_ASSERT_LINKED_LIST(expectedBlock, nodeH->children[0]->children[0]->block);
   TEST_ASSERT_NULL(nodeH->block);
   TEST_ASSERT_EQUAL_PTR(nodeH, nodeH->children[0]->parent);
@@ -1476,23 +1845,23 @@ void test_splitNode_given_treeD_should_form_treeExpected(void){
 
   splitNode(&nodeA);
 
-  LinkedList* testList  = assembleList(&nodeA);
+  Vector* testList  = assembleList(&nodeA);
 
-  LinkedList* expectedList = createLinkedList();
+  Vector* expectedList = createVector(0);
 
-  addListLast(expectedList, nodeA);
-  addListLast(expectedList, nodeB);
-  addListLast(expectedList, nodeC);
-  addListLast(expectedList, nodeD);
-  addListLast(expectedList, nodeE);
-  addListLast(expectedList, nodeF);
-  addListLast(expectedList, nodeG);
-  addListLast(expectedList, nodeH);
-  addListLast(expectedList, nodeH->children[0]);
-  addListLast(expectedList, nodeI);
-  addListLast(expectedList, nodeI->children[0]);
+  vectorAddLast(expectedList, nodeA);
+  vectorAddLast(expectedList, nodeB);
+  vectorAddLast(expectedList, nodeC);
+  vectorAddLast(expectedList, nodeD);
+  vectorAddLast(expectedList, nodeE);
+  vectorAddLast(expectedList, nodeF);
+  vectorAddLast(expectedList, nodeG);
+  vectorAddLast(expectedList, nodeH);
+  vectorAddLast(expectedList, nodeH->children[0]);
+  vectorAddLast(expectedList, nodeI);
+  vectorAddLast(expectedList, nodeI->children[0]);
 
-  TEST_ASSERT_LINKED_LIST(expectedList, testList);
+  TEST_ASSERT_VECTOR(expectedList, testList);
   TEST_ASSERT_LINKED_LIST(expectedBlock1, nodeH->children[0]->block);
   TEST_ASSERT_LINKED_LIST(expectedBlock2, nodeI->children[0]->block);
   TEST_ASSERT_NULL(nodeH->block);
@@ -1507,4 +1876,325 @@ void test_splitNode_given_treeD_should_form_treeExpected(void){
   TEST_ASSERT_EQUAL(4,nodeI->children[0]->rank);
   TEST_ASSERT_EQUAL_PTR(nodeH->children[0], nodeF->children[0]);
   TEST_ASSERT_EQUAL_PTR(nodeI->children[0], nodeF->children[0]->children[0]);
-}
\ No newline at end of file
+}
+/**
+ *  splitNode on a switch of 1000 case joining at (J), every node should
+ *  be left with at most 2 parents and the Expression of J at the bottom
+ *  of the chain
+ *
+ *         (A)
+ *      /  / \  \
+ *   (S0)(S1)..(S999)
+ *      \  \ /  /
+ *         (J)
+ *
+ ***************************************************************************/
+void test_splitNode_given_wide_join_should_split_it_in_one_pass(void){
+  int i, numOfCase = 1000;
+  Node* nodeA = createNode(0);
+  Node* nodeJ = createNode(2);
+  Node** caseNode = malloc(sizeof(Node*) * numOfCase);
+  Node* nodePtr;
+  LinkedList* expectedBlock = nodeJ->block;
+
+  for(i = 0; i < numOfCase; i++){
+    caseNode[i] = createNode(1);
+    addChild(&nodeA, &caseNode[i]);
+    addChild(&caseNode[i], &nodeJ);
+  }
+
+  splitNode(&nodeA);
+
+  TEST_ASSERT_EQUAL(2, nodeJ->numOfDirectDom);
+  TEST_ASSERT_EQUAL_PTR(caseNode[0], nodeJ->directDom[0]);
+  TEST_ASSERT_EQUAL_PTR(caseNode[1], nodeJ->directDom[1]);
+  TEST_ASSERT_NULL(nodeJ->block);
+
+  nodePtr = nodeJ;
+  for(i = 2; i < numOfCase; i++){
+    TEST_ASSERT_EQUAL(1, nodePtr->numOfChild);
+    nodePtr = nodePtr->children[0];
+    TEST_ASSERT_EQUAL(2, nodePtr->numOfDirectDom);
+    TEST_ASSERT_EQUAL_PTR(caseNode[i], nodePtr->directDom[1]);
+    TEST_ASSERT_EQUAL_PTR(nodePtr, caseNode[i]->children[0]);
+  }
+  TEST_ASSERT_EQUAL(0, nodePtr->numOfChild);
+  TEST_ASSERT_EQUAL_PTR(expectedBlock, nodePtr->block);
+
+  destroyCFG(nodeA);
+  free(caseNode);
+}
+
+/**
+ *  splitNode should keep the directDom order of the node after the join,
+ *  the phiFunction operands and the branch condition follow it
+ *
+ *         (A)                          (A)
+ *       /  |  \                      /  |  \
+ *    (B)  (C)  (D)                 (B)  (C)  (D)
+ *       \  |  /                      \  /    |
+ *         (J)    (X)      =>          (J)    |   (X)
+ *           \    /                       \   |    |
+ *            (K)                         (new)   |
+ *                                           \   /
+ *                                            (K)     K->directDom : new, X
+ *
+ ***************************************************************************/
+void test_splitNode_should_keep_the_directDom_order_of_the_successor(void){
+  Node* nodeA = createNode(0);
+  Node* nodeB = createNode(1);
+  Node* nodeC = createNode(1);
+  Node* nodeD = createNode(1);
+  Node* nodeX = createNode(1);
+  Node* nodeJ = createNode(2);
+  Node* nodeK = createNode(3);
+
+  addChild(&nodeA, &nodeB);
+  addChild(&nodeA, &nodeC);
+  addChild(&nodeA, &nodeD);
+  addChild(&nodeA, &nodeX);
+  addChild(&nodeB, &nodeJ);
+  addChild(&nodeC, &nodeJ);
+  addChild(&nodeD, &nodeJ);
+  addChild(&nodeJ, &nodeK);
+  addChild(&nodeX, &nodeK);
+
+  splitNode(&nodeA);
+
+  TEST_ASSERT_EQUAL(2, nodeK->numOfDirectDom);
+  TEST_ASSERT_EQUAL_PTR(nodeJ->children[0], nodeK->directDom[0]);
+  TEST_ASSERT_EQUAL_PTR(nodeX, nodeK->directDom[1]);
+  TEST_ASSERT_EQUAL_PTR(nodeD, nodeK->directDom[0]->directDom[1]);
+
+  destroyCFG(nodeA);
+}
+
+/**
+ *  splitCriticalEdges
+ *
+ *        (A)                     (A)
+ *       /   \                   /   \
+ *     (B)    \       =>       (B)   (new1)
+ *     / \     |       =>       / \     |
+ *   (D)  \    |             (D) (new2) |
+ *         \   |                    \  |
+ *          (C)                      (C)
+ *
+ *  A->C and B->C are critical, B->D is not as D has a single directDom
+ *
+ */
+void test_splitCriticalEdges_should_put_a_node_on_every_critical_edge(void){
+  Node* nodeA = createNode(0);
+  Node* nodeB = createNode(1);
+  Node* nodeC = createNode(2);
+  Node* nodeD = createNode(2);
+
+  addChild(&nodeA, &nodeB);
+  addChild(&nodeA, &nodeC);
+  addChild(&nodeB, &nodeD);
+  addChild(&nodeB, &nodeC);
+  setLastBrhDom(&nodeA);
+  getAllDomFrontiers(&nodeA);
+  TEST_ASSERT_EQUAL(4, getNodeOrder(nodeA, ORDER_RPO)->length);
+
+  Vector* newList = splitCriticalEdges(&nodeA);
+  TEST_ASSERT_EQUAL(2, newList->length);
+  Node* newNode1  = newList->item[0];
+  Node* newNode2  = newList->item[1];
+
+  TEST_ASSERT_EQUAL_PTR(newNode1, nodeA->children[1]);
+  TEST_ASSERT_EQUAL_PTR(newNode2, nodeB->children[1]);
+  TEST_ASSERT_EQUAL_PTR(nodeD, nodeB->children[0]);
+  TEST_ASSERT_EQUAL(2, nodeC->numOfDirectDom);
+  TEST_ASSERT_EQUAL_PTR(newNode1, nodeC->directDom[0]);
+  TEST_ASSERT_EQUAL_PTR(newNode2, nodeC->directDom[1]);
+  TEST_ASSERT_EQUAL_PTR(newNode2, nodeC->parent);
+
+  TEST_ASSERT_EQUAL(1, newNode1->numOfChild);
+  TEST_ASSERT_EQUAL_PTR(nodeC, newNode1->children[0]);
+  TEST_ASSERT_EQUAL(1, newNode1->numOfDirectDom);
+  TEST_ASSERT_EQUAL_PTR(nodeA, newNode1->directDom[0]);
+  TEST_ASSERT_EQUAL_PTR(nodeA, newNode1->parent);
+  TEST_ASSERT_EQUAL_PTR(nodeA, newNode1->imdDom);
+  TEST_ASSERT_EQUAL(1, newNode1->rank);
+  TEST_ASSERT_EQUAL_PTR(nodeB, newNode2->imdDom);
+  TEST_ASSERT_EQUAL(2, newNode2->rank);
+  TEST_ASSERT_EQUAL(0, newNode2->block->length);
+  TEST_ASSERT_EQUAL(1, newNode2->domFrontiers->length);
+  TEST_ASSERT_EQUAL_PTR(nodeC, newNode2->domFrontiers->item[0]);
+
+  TEST_ASSERT_EQUAL(6, getNodeOrder(nodeA, ORDER_RPO)->length);
+  destroyVector(newList);
+  destroyCFG(nodeA);
+}
+
+/**
+ *  splitCriticalEdges
+ *
+ *      (A)                    (A)
+ *       |                      |
+ *      (B) <--+     =>        (B) <-----+
+ *      / \    |     =>        / \       |
+ *    (D) (C)--+             (D) (C)--(new1)
+ *          |                      |
+ *         (E)                    (E)
+ *
+ *  The back edge C->B is split, the new node come after C in rank
+ *
+ */
+void test_splitCriticalEdges_given_loop_should_split_the_back_edge(void){
+  Node* nodeA = createNode(0);
+  Node* nodeB = createNode(1);
+  Node* nodeC = createNode(2);
+  Node* nodeD = createNode(2);
+  Node* nodeE = createNode(3);
+
+  addChild(&nodeA, &nodeB);
+  addChild(&nodeB, &nodeD);
+  addChild(&nodeB, &nodeC);
+  addChild(&nodeC, &nodeB);
+  addChild(&nodeC, &nodeE);
+
+  Vector* newList = splitCriticalEdges(&nodeA);
+  TEST_ASSERT_EQUAL(1, newList->length);
+  Node* newNode1  = newList->item[0];
+
+  TEST_ASSERT_EQUAL_PTR(newNode1, nodeC->children[0]);
+  TEST_ASSERT_EQUAL_PTR(nodeE, nodeC->children[1]);
+  TEST_ASSERT_EQUAL_PTR(nodeB, newNode1->children[0]);
+  TEST_ASSERT_EQUAL_PTR(nodeA, nodeB->directDom[0]);
+  TEST_ASSERT_EQUAL_PTR(newNode1, nodeB->directDom[1]);
+  TEST_ASSERT_EQUAL(3, newNode1->rank);
+  destroyVector(newList);
+
+  newList = splitCriticalEdges(&nodeA);
+  TEST_ASSERT_EQUAL(0, newList->length);
+  destroyVector(newList);
+  destroyCFG(nodeA);
+}
+
+/**
+ *  splitCriticalEdges
+ *
+ *        (A)                    (A)
+ *       /   \                  /   \
+ *     (C)   (X)      =>     (new1) (X)
+ *    |  ^                      |
+ *    v  |                     (C) <-+
+ *     (D)                      |    |
+ *                             (D) --+
+ *
+ *  A->C is the only way into the loop, the new node dominate C
+ *
+ */
+void test_splitCriticalEdges_given_loop_entry_should_give_the_new_node_as_imdDom(void){
+  Node* nodeA = createNode(0);
+  Node* nodeC = createNode(1);
+  Node* nodeX = createNode(1);
+  Node* nodeD = createNode(2);
+
+  addChild(&nodeA, &nodeC);
+  addChild(&nodeA, &nodeX);
+  addChild(&nodeC, &nodeD);
+  addChild(&nodeD, &nodeC);
+  setLastBrhDom(&nodeA);
+  setAllImdDom(&nodeA);
+  getAllDomFrontiers(&nodeA);
+  TEST_ASSERT_EQUAL_PTR(nodeA, nodeC->imdDom);
+  TEST_ASSERT_EQUAL_PTR(nodeC, nodeD->imdDom);
+  TEST_ASSERT_EQUAL(1, nodeC->domFrontiers->length);
+  TEST_ASSERT_EQUAL_PTR(nodeC, nodeC->domFrontiers->item[0]);
+
+  Vector* newList = splitCriticalEdges(&nodeA);
+  TEST_ASSERT_EQUAL(1, newList->length);
+  Node* newNode1  = newList->item[0];
+
+  TEST_ASSERT_EQUAL_PTR(newNode1, nodeA->children[0]);
+  TEST_ASSERT_EQUAL_PTR(newNode1, nodeC->directDom[0]);
+  TEST_ASSERT_EQUAL_PTR(nodeA, newNode1->imdDom);
+  TEST_ASSERT_EQUAL_PTR(newNode1, nodeC->imdDom);
+  TEST_ASSERT_EQUAL_PTR(nodeC, nodeD->imdDom);
+  TEST_ASSERT_EQUAL_PTR(nodeA, nodeX->imdDom);
+  TEST_ASSERT_EQUAL(0, newNode1->domFrontiers->length);
+  TEST_ASSERT_EQUAL(1, nodeC->domFrontiers->length);
+  TEST_ASSERT_EQUAL_PTR(nodeC, nodeC->domFrontiers->item[0]);
+
+  destroyVector(newList);
+  destroyCFG(nodeA);
+}
+
+void test_splitCriticalEdges_given_NULL_should_throw_ERR_NULL_NODE(void){
+  Node* nodeA = NULL;
+  ErrorObject* err;
+  Try{
+    splitCriticalEdges(&nodeA);
+    TEST_FAIL_MESSAGE("Expected ERR_NULL_NODE but none thrown");
+  }Catch(err){
+    TEST_ASSERT_EQUAL(ERR_NULL_NODE, err->errorCode);
+    freeError(err);
+  }
+}
+
+/**
+ *  destroyCFG
+ *
+ *      (A)
+ *     /   \
+ *   (B)   (C)
+ *     \   /  ^
+ *      (D)   |
+ *       \>>>>/
+ *
+ *  Every node should be freed exactly once even when it is shared by two
+ *  parent or sit on a loop, the expressions go together with their node
+ *
+ ***************************************************************************/
+void test_destroyCFG_should_free_shared_node_once(void){
+  Node* nodeA = createNode(0);
+  Node* nodeB = createNode(1);
+  Node* nodeC = createNode(1);
+  Node* nodeD = createNode(2);
+
+  addChild(&nodeA, &nodeB);
+  addChild(&nodeA, &nodeC);
+  addChild(&nodeB, &nodeD);
+  addChild(&nodeC, &nodeD);
+  addChild(&nodeD, &nodeC);
+  addListLast(nodeD->block, createExpression('x', ASSIGN, 3, 0, 0));
+  addListLast(nodeB->block, createExpression('y', ASSIGN, 2, 0, 0));
+
+  resetMemoryStats();
+  destroyCFG(nodeA);
+
+  TEST_ASSERT_EQUAL(4, getMemoryStats(MEM_NODE).numOfFree);
+  TEST_ASSERT_EQUAL(2, getMemoryStats(MEM_EXPRESSION).numOfFree);
+}
+
+/**
+ *  getAllDomFrontiers
+ *  Building the dominance frontiers again should give back every
+ *  temporary list and the old domFrontiers of the nodes, so the memory
+ *  in use stay the same round after round
+ *
+ ***************************************************************************/
+void test_getAllDomFrontiers_should_give_back_every_temporary_list(void){
+  Node* nodeA = createNode(0);
+  Node* nodeB = createNode(1);
+  Node* nodeC = createNode(1);
+  Node* nodeD = createNode(2);
+
+  addChild(&nodeA, &nodeB);
+  addChild(&nodeA, &nodeC);
+  addChild(&nodeB, &nodeD);
+  addChild(&nodeC, &nodeD);
+  setLastBrhDom(&nodeA);
+  setAllImdDom(&nodeA);
+  destroyVector(getAllDomFrontiers(&nodeA));
+
+  resetMemoryStats();
+  destroyVector(getAllDomFrontiers(&nodeA));
+  MemoryStats listStats = getMemoryStats(MEM_LIST);
+
+  TEST_ASSERT_EQUAL(listStats.bytesAlloc, listStats.bytesFreed);
+  destroyCFG(nodeA);
+}
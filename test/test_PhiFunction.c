@@ -6,6 +6,13 @@
 #include "ErrorObject.h"
 #include "customAssertion.h"
 #include "LinkedList.h"
+#include "Vector.h"
+#include "BitSet.h"
+#include "LcaIndex.h"
+#include "VersionMap.h"
+#include "VersionTree.h"
+#include "Arena.h"
+#include "Allocator.h"
 #include "CException.h"
 #include <stdlib.h>
 #include <stdio.h>
@@ -59,8 +66,14 @@ void test_getPhiFunction_given_ListA_and_ListB_shoudl_return_PhiFunction_of_x(vo
   addListLast(nodeA->block, exp1);
   addListLast(nodeB->block, exp2);
 
-  LinkedList* listA = getSubsList(nodeA->block);
-  LinkedList* listB = getSubsList(nodeB->block);
+  VersionMap* listA = createVersionMap(0);
+  VersionMap* listB = createVersionMap(0);
+  versionMapPut(listA, exp1->oprdA, NULL);
+  versionMapPut(listA, exp1->oprdB, NULL);
+  versionMapPut(listA, exp1->id, NULL);
+  versionMapPut(listB, exp2->oprdA, NULL);
+  versionMapPut(listB, exp2->oprdB, NULL);
+  versionMapPut(listB, exp2->id, NULL);
   
   Subscript* subs = createSubscript(x, 2);
   Expression* phiFunction = getPhiFunction(listA, listB, subs);
@@ -97,8 +110,14 @@ void test_getPhiFunction_given_ListA_and_ListB_shoudl_throw_ERR_UNDECLARE_VARIAB
     addListLast(nodeA->block, exp1);
     addListLast(nodeB->block, exp2);
     
-    LinkedList* listA = getSubsList(nodeA->block);
-    LinkedList* listB = getSubsList(nodeB->block);
+    VersionMap* listA = createVersionMap(0);
+    VersionMap* listB = createVersionMap(0);
+    versionMapPut(listA, exp1->oprdA, NULL);
+    versionMapPut(listA, exp1->oprdB, NULL);
+    versionMapPut(listA, exp1->id, NULL);
+    versionMapPut(listB, exp2->oprdA, NULL);
+    versionMapPut(listB, exp2->oprdB, NULL);
+    versionMapPut(listB, exp2->id, NULL);
     
     Subscript* subs = createSubscript(w, 3);
     Expression* phiFunction = getPhiFunction(listA, listB, subs);
@@ -106,11 +125,84 @@ void test_getPhiFunction_given_ListA_and_ListB_shoudl_throw_ERR_UNDECLARE_VARIAB
   } Catch(err){
     TEST_ASSERT_EQUAL(ERR_UNDECLARE_VARIABLE, err->errorCode);
     TEST_ASSERT_EQUAL_STRING("Undefine reference to Subscript w", err->errorMsg);
-    free(err);
+    freeError(err);
   }
   
 }
 
+/**
+ *  getNaryPhiFunction
+ *
+ *  List0 : x1->y2
+ *  List1 : x4->y3
+ *  List2 : x6->y0
+ *
+ *  getNaryPhiFunction({List0, List1, List2}, 3, x6) should return
+ *  x7 = Phi(x1, x4, x6)
+ *  with oprdB and oprdA repeating the first two operand
+ *
+ *************************************************************/
+void test_getNaryPhiFunction_given_three_list_should_take_one_operand_from_each(void){
+  VersionMap* predList[3];
+  Subscript subs;
+  int i, xIndex[] = {1, 4, 6}, yIndex[] = {2, 3, 0};
+
+  for(i = 0; i < 3; i++){
+    predList[i] = createVersionMap(0);
+    subs.name   = x;
+    subs.index  = xIndex[i];
+    versionMapPut(predList[i], subs, NULL);
+    subs.name   = y;
+    subs.index  = yIndex[i];
+    versionMapPut(predList[i], subs, NULL);
+  }
+
+  Expression* phiFunction = getNaryPhiFunction(predList, 3, createSubscript(x, 6));
+  TEST_ASSERT_EQUAL(PHI_FUNC, phiFunction->opr);
+  TEST_ASSERT_EQUAL(3, phiFunction->numOfPhiOprd);
+  TEST_ASSERT_SUBSCRIPT(x, 7, &phiFunction->id);
+  TEST_ASSERT_SUBSCRIPT(x, 1, &phiFunction->phiOprd[0]);
+  TEST_ASSERT_SUBSCRIPT(x, 4, &phiFunction->phiOprd[1]);
+  TEST_ASSERT_SUBSCRIPT(x, 6, &phiFunction->phiOprd[2]);
+  TEST_ASSERT_SUBSCRIPT(x, 1, &phiFunction->oprdB);
+  TEST_ASSERT_SUBSCRIPT(x, 4, &phiFunction->oprdA);
+  freeExpression(phiFunction);
+
+  phiFunction = getNaryPhiFunction(predList, 3, createSubscript(y, 3));
+  TEST_ASSERT_SUBSCRIPT(y, 4, &phiFunction->id);
+  TEST_ASSERT_SUBSCRIPT(y, 2, &phiFunction->phiOprd[0]);
+  TEST_ASSERT_SUBSCRIPT(y, 3, &phiFunction->phiOprd[1]);
+  TEST_ASSERT_SUBSCRIPT(y, 0, &phiFunction->phiOprd[2]);
+  freeExpression(phiFunction);
+
+  for(i = 0; i < 3; i++)
+    destroyVersionMap(predList[i]);
+}
+
+void test_getNaryPhiFunction_given_variable_missing_in_one_list_should_throw_ERR_UNDECLARE_VARIABLE(void){
+  VersionMap* predList[3];
+  Subscript subs = {x, 1};
+  ErrorObject* err;
+  int i;
+
+  for(i = 0; i < 3; i++)
+    predList[i] = createVersionMap(0);
+  versionMapPut(predList[0], subs, NULL);
+  versionMapPut(predList[2], subs, NULL);
+
+  Try{
+    getNaryPhiFunction(predList, 3, &subs);
+    TEST_FAIL_MESSAGE("Expected ERR_UNDECLARE_VARIABLE but no error thrown");
+  } Catch(err){
+    TEST_ASSERT_EQUAL(ERR_UNDECLARE_VARIABLE, err->errorCode);
+    TEST_ASSERT_EQUAL_STRING("Undefine reference to Subscript x", err->errorMsg);
+    freeError(err);
+  }
+
+  for(i = 0; i < 3; i++)
+    destroyVersionMap(predList[i]);
+}
+
 /**
  *  getCondition
  *  should return the subscript that represent the condition of it's immediate
@@ -205,7 +297,7 @@ void test_getCondition_with_the_Block2_above_should_throw_ERR_INVALID_BRANCH(voi
   }Catch(err){
     TEST_ASSERT_EQUAL(ERR_INVALID_BRANCH, err->errorCode);
     TEST_ASSERT_EQUAL_STRING("This operator does not branch", err->errorMsg);
-    free(err);
+    freeError(err);
   }
 }
 
@@ -249,7 +341,7 @@ void test_allocPhiFunc_allocation_after_assignAllNodeSSA(void){
   
   setLastBrhDom(&nodeA);
   setAllDirectDom(&nodeA);
-  assignAllNodeSSA(nodeA, createLinkedList(), createLinkedList());
+  assignAllNodeSSA(nodeA, createVersionMap(0), NULL);
   ErrorObject* err;
   allocPhiFunc(&nodeA);
 
@@ -324,7 +416,7 @@ void test_allocPhiFunc_allocation_after_assignAllNodeSSA_with_empty_nodeF(void){
   setLastBrhDom(&nodeA);
   setAllDirectDom(&nodeA);
   
-  assignAllNodeSSA(nodeA, createLinkedList(), createLinkedList());
+  assignAllNodeSSA(nodeA, createVersionMap(0), NULL);
   ErrorObject* err;
   allocPhiFunc(&nodeA);
 
@@ -343,4 +435,64 @@ void test_allocPhiFunc_allocation_after_assignAllNodeSSA_with_empty_nodeF(void){
   testPhi = createExpression(x, PHI_FUNC, x, x, a);
   setExpression(testPhi, 4, 6, 3);
   TEST_ASSERT_PHIFUNC(testPhi, &nodeG);
-}
\ No newline at end of file
+}
+/**
+ *  allocPhiFunc on a join with three parent
+ *
+ *              [A](x0)
+ *            /   |   \
+ *          \/   \/   \/
+ *     (x1)[B]  [C]  [D](x3)
+ *          \    |(x2)/
+ *          \/  \/  \/
+ *              [E]     <=  x = Phi(xB, xC, xD)
+ *
+ *  E is not split, it get a single phiFunction with one operand per
+ *  directDom, in the order of directDom
+ *
+ ***************************************************************************/
+void test_allocPhiFunc_given_three_way_join_should_place_one_operand_per_directDom(void){
+  Node* nodeA = createNode(0);
+  Node* nodeB = createNode(1);
+  Node* nodeC = createNode(1);
+  Node* nodeD = createNode(1);
+  Node* nodeE = createNode(2);
+  addListLast(nodeA->block, createExpression(x, ASSIGN, 14, 0, 0));
+  addListLast(nodeA->block, createExpression(a, EQUAL_TO, x, x, 0));
+  addListLast(nodeA->block, createExpression(0, IF_STATEMENT, a, (int)&nodeC, 0));
+  addListLast(nodeB->block, createExpression(x, ADDITION, x, x, 0));
+  addListLast(nodeC->block, createExpression(x, MULTIPLICATION, x, x, 0));
+  addListLast(nodeD->block, createExpression(x, SUBTRACTION, x, x, 0));
+  addListLast(nodeE->block, createExpression(x, ADDITION, x, x, 0));
+
+  addChild(&nodeA, &nodeB);
+  addChild(&nodeA, &nodeC);
+  addChild(&nodeA, &nodeD);
+  addChild(&nodeB, &nodeE);
+  addChild(&nodeC, &nodeE);
+  addChild(&nodeD, &nodeE);
+
+  setLastBrhDom(&nodeA);
+  setAllDirectDom(&nodeA);
+  assignAllNodeSSA(nodeA, createVersionMap(0), NULL);
+  allocPhiFunc(&nodeA);
+
+  TEST_ASSERT_EQUAL(3, nodeE->numOfDirectDom);
+  TEST_ASSERT_EQUAL(2, nodeE->block->length);
+
+  Expression* phiFunction = (Expression*)nodeE->block->head->node;
+  Expression* defExpr;
+  int i;
+  TEST_ASSERT_EQUAL(PHI_FUNC, phiFunction->opr);
+  TEST_ASSERT_EQUAL(x, phiFunction->id.name);
+  TEST_ASSERT_EQUAL(3, phiFunction->numOfPhiOprd);
+  TEST_ASSERT_EQUAL(0, phiFunction->condt.name);
+  for(i = 0; i < 3; i++){
+    defExpr = (Expression*)nodeE->directDom[i]->block->head->node;
+    TEST_ASSERT_SUBSCRIPT(x, defExpr->id.index, &phiFunction->phiOprd[i]);
+  }
+  TEST_ASSERT_EQUAL(phiFunction->phiOprd[0].index, phiFunction->oprdB.index);
+  TEST_ASSERT_EQUAL(phiFunction->phiOprd[1].index, phiFunction->oprdA.index);
+  TEST_ASSERT_TRUE(phiFunction->phiOprd[0].index != phiFunction->phiOprd[1].index);
+  TEST_ASSERT_TRUE(phiFunction->phiOprd[1].index != phiFunction->phiOprd[2].index);
+}
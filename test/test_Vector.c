@@ -0,0 +1,124 @@
+#include "unity.h"
+#include "Vector.h"
+#include "Arena.h"
+#include "Allocator.h"
+#include "ErrorObject.h"
+#include "CException.h"
+#include <stdlib.h>
+
+int itemA = 1, itemB = 2, itemC = 3, itemD = 4, itemE = 5;
+
+void setUp(void){}
+
+void tearDown(void){}
+
+void test_createVector(void){
+  Vector* testVector = createVector(0);
+
+  TEST_ASSERT_NOT_NULL(testVector);
+  TEST_ASSERT_NOT_NULL(testVector->item);
+  TEST_ASSERT_EQUAL(0, testVector->length);
+  TEST_ASSERT_TRUE(testVector->capacity > 0);
+}
+
+/**
+ *  vectorAddLast / vectorAddFirst
+ *
+ *  addLast A, B   addFirst C       addLast D
+ *   [A][B]    =>   [C][A][B]   =>   [C][A][B][D]
+ *
+ ***************************************************************************/
+void test_vectorAddLast_and_vectorAddFirst_should_keep_the_order(void){
+  Vector* testVector = createVector(0);
+
+  vectorAddLast(testVector, &itemA);
+  vectorAddLast(testVector, &itemB);
+  vectorAddFirst(testVector, &itemC);
+  vectorAddLast(testVector, &itemD);
+
+  TEST_ASSERT_EQUAL(4, testVector->length);
+  TEST_ASSERT_EQUAL_PTR(&itemC, testVector->item[0]);
+  TEST_ASSERT_EQUAL_PTR(&itemA, testVector->item[1]);
+  TEST_ASSERT_EQUAL_PTR(&itemB, testVector->item[2]);
+  TEST_ASSERT_EQUAL_PTR(&itemD, VECTOR_LAST(testVector));
+}
+
+/**
+ *  vectorAddLast
+ *  Vector should grow when it was full and keep every item stored
+ *
+ ***************************************************************************/
+void test_vectorAddLast_should_grow_when_full(void){
+  Vector* testVector = createVector(2);
+  int i, items[100];
+
+  for(i = 0; i < 100; i++)
+    vectorAddLast(testVector, &items[i]);
+
+  TEST_ASSERT_EQUAL(100, testVector->length);
+  TEST_ASSERT_TRUE(testVector->capacity >= 100);
+  for(i = 0; i < 100; i++)
+    TEST_ASSERT_EQUAL_PTR(&items[i], vectorGet(testVector, i));
+}
+
+/**
+ *  vectorRemoveFirst / vectorRemoveLast
+ *
+ *   [A][B][C][D]   removeFirst => A   removeLast => D    [B][C]
+ *
+ ***************************************************************************/
+void test_vectorRemoveFirst_and_vectorRemoveLast(void){
+  Vector* testVector = createVector(0);
+  vectorAddLast(testVector, &itemA);
+  vectorAddLast(testVector, &itemB);
+  vectorAddLast(testVector, &itemC);
+  vectorAddLast(testVector, &itemD);
+
+  TEST_ASSERT_EQUAL_PTR(&itemA, vectorRemoveFirst(testVector));
+  TEST_ASSERT_EQUAL_PTR(&itemD, vectorRemoveLast(testVector));
+  TEST_ASSERT_EQUAL(2, testVector->length);
+  TEST_ASSERT_EQUAL_PTR(&itemB, testVector->item[0]);
+  TEST_ASSERT_EQUAL_PTR(&itemC, testVector->item[1]);
+}
+
+void test_vectorFind_should_return_position_or_minus_1(void){
+  Vector* testVector = createVector(0);
+  vectorAddLast(testVector, &itemA);
+  vectorAddLast(testVector, &itemB);
+
+  TEST_ASSERT_EQUAL(1, vectorFind(testVector, &itemB));
+  TEST_ASSERT_EQUAL(-1, vectorFind(testVector, &itemE));
+}
+
+void test_vectorRemoveLast_should_throw_ERR_EMPTY_LIST(void){
+  ErrorObject* err;
+  Try{
+    vectorRemoveLast(createVector(0));
+    TEST_FAIL_MESSAGE("Expected ERR_EMPTY_LIST but no error thrown");
+  } Catch(err){
+    TEST_ASSERT_EQUAL(ERR_EMPTY_LIST, err->errorCode);
+  }
+}
+
+void test_vectorGet_should_throw_ERR_INDEX_OUT_OF_RANGE(void){
+  ErrorObject* err;
+  Vector* testVector = createVector(0);
+  vectorAddLast(testVector, &itemA);
+  Try{
+    vectorGet(testVector, 1);
+    TEST_FAIL_MESSAGE("Expected ERR_INDEX_OUT_OF_RANGE but no error thrown");
+  } Catch(err){
+    TEST_ASSERT_EQUAL(ERR_INDEX_OUT_OF_RANGE, err->errorCode);
+  }
+}
+
+void test_vectorAddLast_should_throw_ERR_NULL_ELEMENT(void){
+  ErrorObject* err;
+  Try{
+    vectorAddLast(createVector(0), NULL);
+    TEST_FAIL_MESSAGE("Expected ERR_NULL_ELEMENT but no error thrown");
+  } Catch(err){
+    TEST_ASSERT_EQUAL(ERR_NULL_ELEMENT, err->errorCode);
+    TEST_ASSERT_EQUAL_STRING("ERROR: Element cannot be NULL!", err->errorMsg);
+  }
+}
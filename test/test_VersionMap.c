@@ -0,0 +1,158 @@
+#include "unity.h"
+#include "VersionMap.h"
+#include "VersionTree.h"
+#include "ExpressionBlock.h"
+#include "GetList.h"
+#include "LinkedList.h"
+#include "Vector.h"
+#include "BitSet.h"
+#include "LcaIndex.h"
+#include "Arena.h"
+#include "Allocator.h"
+#include "NodeChain.h"
+#include "customAssertion.h"
+#include "ErrorObject.h"
+#include "CException.h"
+#include <stdlib.h>
+
+int w = 119;
+int x = 120;
+int y = 121;
+int z = 122;
+
+void setUp(void){}
+
+void tearDown(void){}
+
+void test_createVersionMap(void){
+  VersionMap* testMap = createVersionMap(0);
+  int i;
+
+  TEST_ASSERT_NOT_NULL(testMap);
+  TEST_ASSERT_EQUAL(0, testMap->length);
+  TEST_ASSERT_EQUAL(8, testMap->capacity);
+  TEST_ASSERT_EQUAL(16, testMap->numOfSlot);
+  for(i = 0; i < testMap->numOfSlot; i++)
+    TEST_ASSERT_EQUAL(VERSION_MAP_EMPTY_SLOT, testMap->slot[i]);
+  TEST_ASSERT_NULL(versionMapFind(testMap, x));
+}
+
+/**
+ *  versionMapPut
+ *
+ *  put x0, y1, x2
+ *  x2 should overwrite x0 and keep the position of x0
+ *
+ *  item : x2->y1
+ *
+ *************************************************************************/
+void test_versionMapPut_should_overwrite_the_same_name_and_keep_the_position(void){
+  Expression* exp1 = createExpression(x, ASSIGN, 3, 0, 0);
+  Expression* exp2 = createExpression(x, ADDITION, x, x, 0);
+  VersionMap* testMap = createVersionMap(0);
+  Subscript subs;
+
+  subs.name = x; subs.index = 0;
+  versionMapPut(testMap, subs, exp1);
+  subs.name = y; subs.index = 1;
+  versionMapPut(testMap, subs, NULL);
+  subs.name = x; subs.index = 2;
+  versionMapPut(testMap, subs, exp2);
+
+  TEST_ASSERT_EQUAL(2, testMap->length);
+  TEST_ASSERT_SUBSCRIPT(x, 2, &testMap->item[0]);
+  TEST_ASSERT_SUBSCRIPT(y, 1, &testMap->item[1]);
+  TEST_ASSERT_SUBSCRIPT(x, 2, versionMapFind(testMap, x));
+  TEST_ASSERT_EQUAL_PTR(exp2, versionMapGetDefSite(testMap, x));
+  TEST_ASSERT_NULL(versionMapGetDefSite(testMap, y));
+  TEST_ASSERT_NULL(versionMapFind(testMap, z));
+}
+
+/**
+ *  versionMapPut
+ *
+ *  The map should grow and every variable should still be found
+ *  after the hash table was rebuilt.
+ *
+ *************************************************************************/
+void test_versionMapPut_given_thousands_of_variable_should_find_all_of_them(void){
+  VersionMap* testMap = createVersionMap(0);
+  Subscript subs;
+  int i;
+
+  for(i = 0; i < 5000; i++){
+    subs.name  = i;
+    subs.index = i * 2;
+    versionMapPut(testMap, subs, NULL);
+  }
+
+  TEST_ASSERT_EQUAL(5000, testMap->length);
+  TEST_ASSERT_TRUE(testMap->numOfSlot >= testMap->length * 2);
+  for(i = 0; i < 5000; i++){
+    TEST_ASSERT_SUBSCRIPT(i, i * 2, versionMapFind(testMap, i));
+  }
+  TEST_ASSERT_NULL(versionMapFind(testMap, 5000));
+}
+
+/**
+ *  createVersionMap
+ *
+ *  A capacity that is not a power of two is rounded up, so the probing
+ *  still reach every slot and the 9th name does not loop forever.
+ *
+ *************************************************************************/
+void test_createVersionMap_given_10_should_round_up_and_find_every_name(void){
+  VersionMap* testMap = createVersionMap(10);
+  Subscript subs;
+  int i;
+
+  TEST_ASSERT_EQUAL(16, testMap->capacity);
+  TEST_ASSERT_EQUAL(32, testMap->numOfSlot);
+  for(i = 0; i < 40; i++){
+    subs.name  = 'a' + i;
+    subs.index = i;
+    versionMapPut(testMap, subs, NULL);
+  }
+
+  TEST_ASSERT_EQUAL(40, testMap->length);
+  for(i = 0; i < 40; i++){
+    TEST_ASSERT_SUBSCRIPT('a' + i, i, versionMapFind(testMap, 'a' + i));
+  }
+  destroyVersionMap(testMap);
+}
+
+/**
+ *  updateList
+ *
+ *  x0 = 3
+ *  x1 = x0 + x0
+ *
+ *  updateList should record x1 and the expression that defined it
+ *
+ *************************************************************************/
+void test_updateList_should_record_the_definition_site(void){
+  Expression* exp1 = createExpression(x, ASSIGN, 3, 0, 0);
+  Expression* exp2 = createExpression(x, ADDITION, x, x, 0);
+  Node* testNode = createNode(0);
+  addListLast(testNode->block, exp1);
+  addListLast(testNode->block, exp2);
+  arrangeSSA(testNode);
+
+  VersionMap* testMap = createVersionMap(0);
+  updateList(testNode, testMap);
+
+  TEST_ASSERT_EQUAL(1, testMap->length);
+  TEST_ASSERT_SUBSCRIPT(x, 1, versionMapFind(testMap, x));
+  TEST_ASSERT_EQUAL_PTR(exp2, versionMapGetDefSite(testMap, x));
+}
+
+void test_versionMapFind_given_NULL_should_throw_ERR_NULL_LIST(void){
+  ErrorObject* err;
+  Try{
+    versionMapFind(NULL, x);
+    TEST_FAIL_MESSAGE("Expected ERR_NULL_LIST but no error thrown");
+  } Catch(err){
+    TEST_ASSERT_EQUAL(ERR_NULL_LIST, err->errorCode);
+    TEST_ASSERT_EQUAL_STRING("ERROR: VersionMap cannot be NULL!", err->errorMsg);
+  }
+}
@@ -0,0 +1,170 @@
+#include "unity.h"
+#include "VersionTree.h"
+#include "VersionMap.h"
+#include "ExpressionBlock.h"
+#include "GetList.h"
+#include "LinkedList.h"
+#include "Vector.h"
+#include "BitSet.h"
+#include "LcaIndex.h"
+#include "Arena.h"
+#include "Allocator.h"
+#include "NodeChain.h"
+#include "customAssertion.h"
+#include "ErrorObject.h"
+#include "CException.h"
+#include <stdlib.h>
+
+int w = 119;
+int x = 120;
+int y = 121;
+int z = 122;
+
+void setUp(void){}
+
+void tearDown(void){}
+
+static Subscript subscriptOf(int name, int index){
+  Subscript subs;
+  subs.name  = name;
+  subs.index = index;
+  return subs;
+}
+
+/**
+ *  versionTreePut
+ *
+ *  treeA = {w0, x1, y2}
+ *  treeB = versionTreePut(treeA, y3)
+ *
+ *  treeB should see y3, treeA should still see y2 and both tree
+ *  should share the w0 node
+ *
+ *************************************************************************/
+void test_versionTreePut_should_not_change_the_old_tree(void){
+  VersionTree* treeA = NULL;
+  treeA = versionTreePut(treeA, subscriptOf(x, 1), NULL);
+  treeA = versionTreePut(treeA, subscriptOf(w, 0), NULL);
+  treeA = versionTreePut(treeA, subscriptOf(y, 2), NULL);
+
+  VersionTree* treeB = versionTreePut(treeA, subscriptOf(y, 3), NULL);
+
+  TEST_ASSERT_EQUAL(3, versionTreeSize(treeA));
+  TEST_ASSERT_EQUAL(3, versionTreeSize(treeB));
+  TEST_ASSERT_SUBSCRIPT(y, 2, versionTreeFind(treeA, y));
+  TEST_ASSERT_SUBSCRIPT(y, 3, versionTreeFind(treeB, y));
+  TEST_ASSERT_SUBSCRIPT(w, 0, versionTreeFind(treeB, w));
+  TEST_ASSERT_EQUAL_PTR(treeA->left, treeB->left);
+  TEST_ASSERT_NULL(versionTreeFind(treeB, z));
+}
+
+/**
+ *  versionTreePut
+ *
+ *  Putting the same Subscript again should give back the same tree.
+ *
+ *************************************************************************/
+void test_versionTreePut_given_the_same_subscript_should_return_the_same_tree(void){
+  Expression* exp1 = createExpression(x, ASSIGN, 3, 0, 0);
+  VersionTree* testTree = versionTreePut(NULL, subscriptOf(x, 0), exp1);
+
+  TEST_ASSERT_EQUAL_PTR(testTree, versionTreePut(testTree, subscriptOf(x, 0), exp1));
+  TEST_ASSERT_EQUAL_PTR(exp1, versionTreeGetDefSite(testTree, x));
+}
+
+/**
+ *  versionTreePut
+ *
+ *  1000 variables put in increasing order should still give a balanced
+ *  tree, height of an AVL tree is below 1.45 * log2(n)
+ *
+ *************************************************************************/
+void test_versionTreePut_should_keep_the_tree_balanced(void){
+  VersionTree *testTree = NULL, *oldTree;
+  int i;
+
+  for(i = 0; i < 1000; i++)
+    testTree = versionTreePut(testTree, subscriptOf(i, i), NULL);
+  oldTree  = testTree;
+  testTree = versionTreePut(testTree, subscriptOf(500, 7), NULL);
+
+  TEST_ASSERT_EQUAL(1000, versionTreeSize(testTree));
+  TEST_ASSERT_TRUE(testTree->height <= 15);
+  for(i = 0; i < 1000; i++){
+    TEST_ASSERT_SUBSCRIPT(i, i, versionTreeFind(oldTree, i));
+  }
+  TEST_ASSERT_SUBSCRIPT(500, 7, versionTreeFind(testTree, 500));
+}
+
+/**
+ *  destroyVersionTree
+ *
+ *  treeB share most of its nodes with treeA, destroying treeA should
+ *  leave treeB whole and destroying treeB too should free every node
+ *
+ *************************************************************************/
+void test_destroyVersionTree_should_free_a_node_with_its_last_owner(void){
+  VersionTree *treeA = NULL, *treeB, *newTree;
+  MemoryStats listStats;
+  int i;
+
+  resetMemoryStats();
+  for(i = 0; i < 100; i++){
+    newTree = versionTreePut(treeA, subscriptOf(i, i), NULL);
+    destroyVersionTree(treeA);
+    treeA = newTree;
+  }
+  treeB = versionTreePut(treeA, subscriptOf(50, 7), NULL);
+  destroyVersionTree(treeA);
+
+  TEST_ASSERT_EQUAL(100, versionTreeSize(treeB));
+  for(i = 0; i < 100; i++){
+    TEST_ASSERT_SUBSCRIPT(i, i == 50 ? 7 : i, versionTreeFind(treeB, i));
+  }
+  destroyVersionTree(treeB);
+
+  listStats = getMemoryStats(MEM_LIST);
+  TEST_ASSERT_EQUAL(listStats.numOfAlloc, listStats.numOfFree);
+  TEST_ASSERT_EQUAL(listStats.bytesAlloc, listStats.bytesFreed);
+}
+
+/**
+ *  getLatestTree
+ *
+ *  NodeA:
+ *  x0 = 3
+ *  x1 = y0 + x0
+ *  x2 = x1 * z0
+ *
+ *  NodeB:
+ *  w0 = x2 + y0
+ *
+ *  getLatestTree(NodeB, getLatestTree(NodeA, NULL)) should give x2, w0
+ *  and the tree of NodeA should only have x2
+ *
+ *************************************************************************/
+void test_getLatestTree_should_derive_a_new_version_for_NodeB(void){
+  Node* nodeA = createNode(0);
+  Node* nodeB = createNode(1);
+  Expression* exp1 = createExpression(x, ASSIGN, 3, 0, 0);
+  Expression* exp2 = createExpression(x, ADDITION, y, x, 0);
+  Expression* exp3 = createExpression(x, MULTIPLICATION, x, z, 0);
+  Expression* exp4 = createExpression(w, MULTIPLICATION, x, y, 0);
+
+  addListLast(nodeA->block, exp1);
+  addListLast(nodeA->block, exp2);
+  addListLast(nodeA->block, exp3);
+  addListLast(nodeB->block, exp4);
+  arrangeSSA(nodeA);
+  arrangeSSA(nodeB);
+
+  VersionTree* treeA = getLatestTree(nodeA, NULL);
+  VersionTree* treeB = getLatestTree(nodeB, treeA);
+
+  TEST_ASSERT_EQUAL(1, versionTreeSize(treeA));
+  TEST_ASSERT_EQUAL(2, versionTreeSize(treeB));
+  TEST_ASSERT_SUBSCRIPT(x, 2, versionTreeFind(treeB, x));
+  TEST_ASSERT_SUBSCRIPT(w, 0, versionTreeFind(treeB, w));
+  TEST_ASSERT_EQUAL_PTR(exp3, versionTreeGetDefSite(treeB, x));
+  TEST_ASSERT_NULL(versionTreeFind(treeA, w));
+}